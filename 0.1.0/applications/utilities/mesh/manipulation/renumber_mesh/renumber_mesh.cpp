@@ -14,6 +14,7 @@
 #include "renumber_method.hpp"
 #include "zero_gradient_fv_patch_fields.hpp"
 #include "cuthill_mc_kee_renumber.hpp"
+#include "poly_mesh_renumber.hpp"
 #include "fv_mesh_subset.hpp"
 #include "cell_set.hpp"
 #include "face_set.hpp"
@@ -56,20 +57,6 @@ tmp<volScalarField> createScalarField
 }
 
 
-// Calculate band of matrix
-label getBand(const labelList& owner, const labelList& neighbour)
-{
-  label band = 0;
-  FOR_ALL(neighbour, faceI) {
-    label diff = neighbour[faceI] - owner[faceI];
-    if (diff > band) {
-      band = diff;
-    }
-  }
-  return band;
-}
-
-
 // Calculate band of matrix
 void getBand
 (
@@ -109,66 +96,6 @@ void getBand
 }
 
 
-// Determine upper-triangular face order
-labelList getFaceOrder
-(
-  const primitiveMesh& mesh,
-  const labelList& cellOrder      // New to old cell
-)
-{
-  labelList reverseCellOrder{invert(cellOrder.size(), cellOrder)};
-  labelList oldToNewFace{mesh.nFaces(), -1};
-  label newFaceI = 0;
-  labelList nbr;
-  labelList order;
-  FOR_ALL(cellOrder, newCellI) {
-    label oldCellI = cellOrder[newCellI];
-    const cell& cFaces = mesh.cells()[oldCellI];
-    // Neighbouring cells
-    nbr.setSize(cFaces.size());
-    FOR_ALL(cFaces, i) {
-      label faceI = cFaces[i];
-      if (mesh.isInternalFace(faceI)) {
-        // Internal face. Get cell on other side.
-        label nbrCellI = reverseCellOrder[mesh.faceNeighbour()[faceI]];
-        if (nbrCellI == newCellI) {
-          nbrCellI = reverseCellOrder[mesh.faceOwner()[faceI]];
-        }
-        nbr[i] = (newCellI < nbrCellI) ? nbrCellI : -1;
-      } else {
-        // External face. Do later.
-        nbr[i] = -1;
-      }
-    }
-    order.setSize(nbr.size());
-    sortedOrder(nbr, order);
-    FOR_ALL(order, i) {
-      label index = order[i];
-      if (nbr[index] != -1) {
-        oldToNewFace[cFaces[index]] = newFaceI++;
-      }
-    }
-  }
-  // Leave patch faces intact.
-  for (label faceI = newFaceI; faceI < mesh.nFaces(); faceI++) {
-    oldToNewFace[faceI] = faceI;
-  }
-  // Check done all faces.
-  FOR_ALL(oldToNewFace, faceI) {
-    if (oldToNewFace[faceI] == -1) {
-      FATAL_ERROR_IN
-      (
-        "getFaceOrder"
-        "(const primitiveMesh&, const labelList&, const labelList&)"
-      )
-      << "Did not determine new position" << " for face " << faceI
-      << abort(FatalError);
-    }
-  }
-  return invert(mesh.nFaces(), oldToNewFace);
-}
-
-
 // Determine face order such that inside region faces are sorted
 // upper-triangular but inbetween region faces are handled like boundary faces.
 labelList getRegionFaceOrder
@@ -269,133 +196,6 @@ labelList getRegionFaceOrder
 }
 
 
-// cellOrder: old cell for every new cell
-// faceOrder: old face for every new face. Ordering of boundary faces not
-//     changed.
-autoPtr<mapPolyMesh> reorderMesh
-(
-  polyMesh& mesh,
-  const labelList& cellOrder,
-  const labelList& faceOrder
-)
-{
-  labelList reverseCellOrder{invert(cellOrder.size(), cellOrder)};
-  labelList reverseFaceOrder{invert(faceOrder.size(), faceOrder)};
-  faceList newFaces{reorder(reverseFaceOrder, mesh.faces())};
-  labelList newOwner
-  {
-    renumber(reverseCellOrder, reorder(reverseFaceOrder, mesh.faceOwner()))
-  };
-  labelList newNeighbour
-  {
-    renumber(reverseCellOrder, reorder(reverseFaceOrder, mesh.faceNeighbour()))
-  };
-  // Check if any faces need swapping.
-  labelHashSet flipFaceFlux{newOwner.size()};
-  FOR_ALL(newNeighbour, faceI) {
-    label own = newOwner[faceI];
-    label nei = newNeighbour[faceI];
-    if (nei < own) {
-      newFaces[faceI].flip();
-      Swap(newOwner[faceI], newNeighbour[faceI]);
-      flipFaceFlux.insert(faceI);
-    }
-  }
-  const polyBoundaryMesh& patches = mesh.boundaryMesh();
-  labelList patchSizes{patches.size()};
-  labelList patchStarts{patches.size()};
-  labelList oldPatchNMeshPoints{patches.size()};
-  labelListList patchPointMap{patches.size()};
-  FOR_ALL(patches, patchI) {
-    patchSizes[patchI] = patches[patchI].size();
-    patchStarts[patchI] = patches[patchI].start();
-    oldPatchNMeshPoints[patchI] = patches[patchI].nPoints();
-    patchPointMap[patchI] = identity(patches[patchI].nPoints());
-  }
-  mesh.resetPrimitives
-  (
-    Xfer<pointField>::null(),
-    xferMove(newFaces),
-    xferMove(newOwner),
-    xferMove(newNeighbour),
-    patchSizes,
-    patchStarts,
-    true
-  );
-  // Re-do the faceZones
-  {
-    faceZoneMesh& faceZones = mesh.faceZones();
-    faceZones.clearAddressing();
-    FOR_ALL(faceZones, zoneI) {
-      faceZone& fZone = faceZones[zoneI];
-      labelList newAddressing{fZone.size()};
-      boolList newFlipMap{fZone.size()};
-      FOR_ALL(fZone, i) {
-        label oldFaceI = fZone[i];
-        newAddressing[i] = reverseFaceOrder[oldFaceI];
-        if (flipFaceFlux.found(newAddressing[i])) {
-          newFlipMap[i] = !fZone.flipMap()[i];
-        } else {
-          newFlipMap[i] = fZone.flipMap()[i];
-        }
-      }
-      labelList newToOld;
-      sortedOrder(newAddressing, newToOld);
-      fZone.resetAddressing
-      (
-        UIndirectList<label>{newAddressing, newToOld}(),
-        UIndirectList<bool>{newFlipMap, newToOld}()
-      );
-    }
-  }
-  // Re-do the cellZones
-  {
-    cellZoneMesh& cellZones = mesh.cellZones();
-    cellZones.clearAddressing();
-    FOR_ALL(cellZones, zoneI) {
-      cellZones[zoneI] =
-        UIndirectList<label>{reverseCellOrder, cellZones[zoneI]}();
-      mousse::sort(cellZones[zoneI]);
-    }
-  }
-  return
-    autoPtr<mapPolyMesh>
-    {
-      new mapPolyMesh
-      {
-        mesh,                       // const polyMesh& mesh,
-        mesh.nPoints(),             // nOldPoints,
-        mesh.nFaces(),              // nOldFaces,
-        mesh.nCells(),              // nOldCells,
-        identity(mesh.nPoints()),   // pointMap,
-        List<objectMap>{0},         // pointsFromPoints,
-        faceOrder,                  // faceMap,
-        List<objectMap>{0},         // facesFromPoints,
-        List<objectMap>{0},         // facesFromEdges,
-        List<objectMap>{0},         // facesFromFaces,
-        cellOrder,                  // cellMap,
-        List<objectMap>{0},         // cellsFromPoints,
-        List<objectMap>{0},         // cellsFromEdges,
-        List<objectMap>{0},         // cellsFromFaces,
-        List<objectMap>{0},         // cellsFromCells,
-        identity(mesh.nPoints()),   // reversePointMap,
-        reverseFaceOrder,           // reverseFaceMap,
-        reverseCellOrder,           // reverseCellMap,
-        flipFaceFlux,               // flipFaceFlux,
-        patchPointMap,              // patchPointMap,
-        labelListList{0},           // pointZoneMap,
-        labelListList{0},           // faceZonePointMap,
-        labelListList{0},           // faceZoneFaceMap,
-        labelListList{0},           // cellZoneMap,
-        pointField{0},              // preMotionPoints,
-        patchStarts,                // oldPatchStarts,
-        oldPatchNMeshPoints,        // oldPatchNMeshPoints
-        autoPtr<scalarField>{}      // oldCellVolumes
-      }
-    };
-}
-
-
 // Return new to old cell numbering
 labelList regionRenumber
 (
@@ -710,13 +510,14 @@ int main(int argc, char *argv[])
       cellOrder = invert(mesh.nCells(), newReverseCellOrder);
     }
     // Determine new to old face order with new cell numbering
-    faceOrder = getFaceOrder(mesh, cellOrder);
+    faceOrder = polyMeshRenumber::faceOrder(mesh, cellOrder);
   }
   if (!overwrite) {
     runTime++;
   }
   // Change the mesh.
-  autoPtr<mapPolyMesh> map = reorderMesh(mesh, cellOrder, faceOrder);
+  autoPtr<mapPolyMesh> map =
+    polyMeshRenumber::reorder(mesh, cellOrder, faceOrder);
   if (orderPoints) {
     polyTopoChange meshMod{mesh};
     autoPtr<mapPolyMesh> pointOrderMap =
@@ -0,0 +1,214 @@
+#ifndef CORE_ALGORITHMS_INDEXED_BVH_HPP_
+#define CORE_ALGORITHMS_INDEXED_BVH_HPP_
+
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+// Class
+//   mousse::indexedBVH
+// Description
+//   Flat bounding volume hierarchy over the shapes of an indexedOctree
+//   shape type, e.g. treeDataTriSurface, treeDataFace, treeDataCell or
+//   treeDataPoint.
+//   The shapes are ordered along a Morton curve through their bounding box
+//   centres and the ordered range is halved recursively until at most
+//   maxLeafSize shapes remain. The nodes are stored depth first in a
+//   single list: the first child of a node is the next node and every
+//   node holds the index of the node following its subtree, so all
+//   queries are loops without recursion or a stack. The shapes of a leaf
+//   are contiguous in the index list and are passed to the shape
+//   operators of Type in one call.
+//   The batched queries visit the samples along a Hilbert curve so that
+//   consecutive samples traverse the same nodes, and the nearest searches
+//   start from the shape found for the previous sample.
+//   Type has to provide shapeBb(index) in addition to the interface used
+//   by indexedOctree.
+
+#include "indexed_octree.hpp"
+#include "space_filling_curve.hpp"
+#include "dynamic_list.hpp"
+#include "sub_list.hpp"
+
+
+namespace mousse {
+
+template<class Type>
+class indexedBVH
+{
+public:
+  // Data types
+    //- Tree node
+    class node
+    {
+    public:
+      //- Bounding box of the shapes of the subtree
+      treeBoundBox bb_;
+      //- Start of the shapes of the subtree in the index list
+      label start_;
+      //- Number of shapes of a leaf, 0 for an internal node
+      label size_;
+      //- Node following the subtree
+      label skip_;
+    };
+private:
+  // Private data
+    //- Null octree holding the shapes, for constructing the shape
+    //  operators of Type
+    const indexedOctree<Type> shapeTree_;
+    //- Maximum number of shapes in a leaf
+    const label maxLeafSize_;
+    //- Shape indices in tree order
+    labelList indices_;
+    //- Nodes in depth-first order
+    List<node> nodes_;
+  // Private Member Functions
+    //- Append the subtree of the shapes indices_[start, start + size)
+    void build
+    (
+      const label start,
+      const label size,
+      const List<treeBoundBox>& shapeBbs,
+      DynamicList<node>& nodes
+    );
+    //- Return the shapes of a leaf
+    SubList<label> leafIndices(const node& leaf) const
+    {
+      return SubList<label>{indices_, leaf.size_, leaf.start_};
+    }
+    //- Squared distance from a point to a box, 0 inside
+    static scalar distSqr(const treeBoundBox& bb, const point& sample);
+    //- Does the part [0, tMax] of the segment start + t*dir hit the box.
+    //  invDir is the componentwise inverse of dir.
+    static bool intersects
+    (
+      const treeBoundBox& bb,
+      const point& start,
+      const vector& invDir,
+      const scalar tMax
+    );
+    //- Return the order in which to visit the samples
+    labelList sampleOrder(const UList<point>& samples) const;
+public:
+  // Constructors
+    //- Construct from shapes
+    indexedBVH(const Type& shapes, const label maxLeafSize = 4);
+    //- Disallow default bitwise copy construct
+    indexedBVH(const indexedBVH&) = delete;
+    //- Disallow default bitwise assignment
+    indexedBVH& operator=(const indexedBVH&) = delete;
+  // Member Functions
+    // Access
+      //- Reference to shape
+      const Type& shapes() const
+      {
+        return shapeTree_.shapes();
+      }
+      //- Null octree holding the shapes, to construct the shape
+      //  operators of Type from
+      const indexedOctree<Type>& shapeTree() const
+      {
+        return shapeTree_;
+      }
+      //- List of all nodes
+      const List<node>& nodes() const
+      {
+        return nodes_;
+      }
+      //- Shape indices in tree order
+      const labelList& indices() const
+      {
+        return indices_;
+      }
+      //- Top bounding box
+      const treeBoundBox& bb() const
+      {
+        if (nodes_.empty()) {
+          FATAL_ERROR_IN("indexedBVH<Type>::bb() const")
+            << "Tree is empty" << abort(FatalError);
+        }
+        return nodes_[0].bb_;
+      }
+    // Queries
+      //- Low level: update the nearest shape within nearestDistSqr
+      template<class FindNearestOp>
+      void findNearest
+      (
+        const point& sample,
+        scalar& nearestDistSqr,
+        label& nearestShapeI,
+        point& nearestPoint,
+        const FindNearestOp& fnOp
+      ) const;
+      //- Calculate nearest point on nearest shape
+      template<class FindNearestOp>
+      pointIndexHit findNearest
+      (
+        const point& sample,
+        const scalar nearestDistSqr,
+        const FindNearestOp& fnOp
+      ) const;
+      pointIndexHit findNearest
+      (
+        const point& sample,
+        const scalar nearestDistSqr
+      ) const;
+      //- Calculate nearest points on nearest shapes of the samples
+      template<class FindNearestOp>
+      List<pointIndexHit> findNearest
+      (
+        const pointField& samples,
+        const scalarField& nearestDistSqr,
+        const FindNearestOp& fnOp
+      ) const;
+      List<pointIndexHit> findNearest
+      (
+        const pointField& samples,
+        const scalarField& nearestDistSqr
+      ) const;
+      //- Find nearest (findAny = false) or any intersection of line
+      //  between start and end
+      template<class FindIntersectOp>
+      pointIndexHit findLine
+      (
+        const point& start,
+        const point& end,
+        const bool findAny,
+        const FindIntersectOp& fiOp
+      ) const;
+      //- Find nearest intersection of line between start and end
+      pointIndexHit findLine(const point& start, const point& end) const;
+      //- Find any intersection of line between start and end
+      pointIndexHit findLineAny(const point& start, const point& end) const;
+      //- Find nearest intersections of the lines between start and end
+      List<pointIndexHit> findLine
+      (
+        const pointField& start,
+        const pointField& end
+      ) const;
+      //- Find any intersections of the lines between start and end
+      List<pointIndexHit> findLineAny
+      (
+        const pointField& start,
+        const pointField& end
+      ) const;
+      //- Find (in no particular order) indices of all shapes inside or
+      //  overlapping bounding box
+      labelList findBox(const treeBoundBox& bb) const;
+      //- Find (in no particular order) indices of all shapes inside or
+      //  overlapping a bounding sphere
+      labelList findSphere
+      (
+        const point& centre,
+        const scalar radiusSqr
+      ) const;
+      //- Find shape containing point. Only implemented for certain
+      //  shapes.
+      label findInside(const point& sample) const;
+      //- Find shapes containing the points
+      labelList findInside(const pointField& samples) const;
+};
+
+}  // namespace mousse
+
+#include "indexed_bvh.ipp"
+
+#endif
@@ -0,0 +1,464 @@
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+
+#include "indexed_bvh.hpp"
+
+
+// Private Member Functions
+template<class Type>
+void mousse::indexedBVH<Type>::build
+(
+  const label start,
+  const label size,
+  const List<treeBoundBox>& shapeBbs,
+  DynamicList<node>& nodes
+)
+{
+  const label nodeI = nodes.size();
+  nodes.append(node());
+  treeBoundBox bb{shapeBbs[indices_[start]]};
+  for (label i = start + 1; i < start + size; i++) {
+    const treeBoundBox& shapeBb = shapeBbs[indices_[i]];
+    bb.min() = min(bb.min(), shapeBb.min());
+    bb.max() = max(bb.max(), shapeBb.max());
+  }
+  nodes[nodeI].bb_ = bb;
+  nodes[nodeI].start_ = start;
+  if (size <= maxLeafSize_) {
+    nodes[nodeI].size_ = size;
+  } else {
+    // Halve the curve ordered range
+    nodes[nodeI].size_ = 0;
+    const label half = size/2;
+    build(start, half, shapeBbs, nodes);
+    build(start + half, size - half, shapeBbs, nodes);
+  }
+  nodes[nodeI].skip_ = nodes.size();
+}
+
+
+template<class Type>
+mousse::scalar mousse::indexedBVH<Type>::distSqr
+(
+  const treeBoundBox& bb,
+  const point& sample
+)
+{
+  scalar d = 0;
+  for (direction cmpt = 0; cmpt < vector::nComponents; cmpt++) {
+    if (sample[cmpt] < bb.min()[cmpt]) {
+      d += sqr(bb.min()[cmpt] - sample[cmpt]);
+    } else if (sample[cmpt] > bb.max()[cmpt]) {
+      d += sqr(sample[cmpt] - bb.max()[cmpt]);
+    }
+  }
+  return d;
+}
+
+
+template<class Type>
+bool mousse::indexedBVH<Type>::intersects
+(
+  const treeBoundBox& bb,
+  const point& start,
+  const vector& invDir,
+  const scalar tMax
+)
+{
+  scalar tNear = 0;
+  scalar tFar = tMax;
+  for (direction cmpt = 0; cmpt < vector::nComponents; cmpt++) {
+    scalar t0 = (bb.min()[cmpt] - start[cmpt])*invDir[cmpt];
+    scalar t1 = (bb.max()[cmpt] - start[cmpt])*invDir[cmpt];
+    if (t0 > t1) {
+      Swap(t0, t1);
+    }
+    tNear = max(tNear, t0);
+    tFar = min(tFar, t1);
+    if (tNear > tFar) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+template<class Type>
+mousse::labelList mousse::indexedBVH<Type>::sampleOrder
+(
+  const UList<point>& samples
+) const
+{
+  if (samples.empty()) {
+    return labelList{};
+  }
+  boundBox sampleBb{samples, false};
+  return spaceFillingCurve{spaceFillingCurve::HILBERT, sampleBb}.order
+  (
+    samples
+  );
+}
+
+
+// Constructors
+template<class Type>
+mousse::indexedBVH<Type>::indexedBVH
+(
+  const Type& shapes,
+  const label maxLeafSize
+)
+:
+  shapeTree_{shapes},
+  maxLeafSize_{max(maxLeafSize, label(1))},
+  indices_{},
+  nodes_{}
+{
+  const label nShapes = shapes.size();
+  if (nShapes == 0) {
+    return;
+  }
+  List<treeBoundBox> shapeBbs{nShapes};
+  pointField centres{nShapes};
+  treeBoundBox bb{point::max, point::min};
+  FOR_ALL(shapeBbs, shapeI) {
+    shapeBbs[shapeI] = shapes.shapeBb(shapeI);
+    centres[shapeI] = shapeBbs[shapeI].midpoint();
+    bb.min() = min(bb.min(), shapeBbs[shapeI].min());
+    bb.max() = max(bb.max(), shapeBbs[shapeI].max());
+  }
+  indices_ = spaceFillingCurve{spaceFillingCurve::MORTON, bb}.order(centres);
+  DynamicList<node> nodes{2*nShapes/maxLeafSize_ + 1};
+  build(0, nShapes, shapeBbs, nodes);
+  nodes_.transfer(nodes);
+}
+
+
+// Member Functions
+template<class Type>
+template<class FindNearestOp>
+void mousse::indexedBVH<Type>::findNearest
+(
+  const point& sample,
+  scalar& nearestDistSqr,
+  label& nearestShapeI,
+  point& nearestPoint,
+  const FindNearestOp& fnOp
+) const
+{
+  label nodeI = 0;
+  while (nodeI < nodes_.size()) {
+    const node& nod = nodes_[nodeI];
+    if (distSqr(nod.bb_, sample) > nearestDistSqr) {
+      nodeI = nod.skip_;
+    } else if (nod.size_ > 0) {
+      fnOp
+      (
+        leafIndices(nod),
+        sample,
+        nearestDistSqr,
+        nearestShapeI,
+        nearestPoint
+      );
+      nodeI = nod.skip_;
+    } else {
+      nodeI++;
+    }
+  }
+}
+
+
+template<class Type>
+template<class FindNearestOp>
+mousse::pointIndexHit mousse::indexedBVH<Type>::findNearest
+(
+  const point& sample,
+  const scalar startDistSqr,
+  const FindNearestOp& fnOp
+) const
+{
+  scalar nearestDistSqr = startDistSqr;
+  label nearestShapeI = -1;
+  point nearestPoint = vector::zero;
+  findNearest(sample, nearestDistSqr, nearestShapeI, nearestPoint, fnOp);
+  return pointIndexHit{nearestShapeI != -1, nearestPoint, nearestShapeI};
+}
+
+
+template<class Type>
+mousse::pointIndexHit mousse::indexedBVH<Type>::findNearest
+(
+  const point& sample,
+  const scalar startDistSqr
+) const
+{
+  return findNearest
+  (
+    sample,
+    startDistSqr,
+    typename Type::findNearestOp{shapeTree_}
+  );
+}
+
+
+template<class Type>
+template<class FindNearestOp>
+mousse::List<mousse::pointIndexHit> mousse::indexedBVH<Type>::findNearest
+(
+  const pointField& samples,
+  const scalarField& startDistSqr,
+  const FindNearestOp& fnOp
+) const
+{
+  List<pointIndexHit> hits{samples.size()};
+  const labelList order{sampleOrder(samples)};
+  // Shape nearest to the previous sample, to start the search from
+  labelList seed{1, -1};
+  FOR_ALL(order, orderI) {
+    const label sampleI = order[orderI];
+    const point& sample = samples[sampleI];
+    scalar nearestDistSqr = startDistSqr[sampleI];
+    label nearestShapeI = -1;
+    point nearestPoint = vector::zero;
+    if (seed[0] != -1) {
+      fnOp(seed, sample, nearestDistSqr, nearestShapeI, nearestPoint);
+    }
+    findNearest(sample, nearestDistSqr, nearestShapeI, nearestPoint, fnOp);
+    hits[sampleI] =
+      pointIndexHit{nearestShapeI != -1, nearestPoint, nearestShapeI};
+    if (nearestShapeI != -1) {
+      seed[0] = nearestShapeI;
+    }
+  }
+  return hits;
+}
+
+
+template<class Type>
+mousse::List<mousse::pointIndexHit> mousse::indexedBVH<Type>::findNearest
+(
+  const pointField& samples,
+  const scalarField& startDistSqr
+) const
+{
+  return findNearest
+  (
+    samples,
+    startDistSqr,
+    typename Type::findNearestOp{shapeTree_}
+  );
+}
+
+
+template<class Type>
+template<class FindIntersectOp>
+mousse::pointIndexHit mousse::indexedBVH<Type>::findLine
+(
+  const point& start,
+  const point& end,
+  const bool findAny,
+  const FindIntersectOp& fiOp
+) const
+{
+  pointIndexHit hitInfo;
+  const vector dir{end - start};
+  const scalar magSqrDir = magSqr(dir);
+  vector invDir;
+  for (direction cmpt = 0; cmpt < vector::nComponents; cmpt++) {
+    invDir[cmpt] = mag(dir[cmpt]) > VSMALL ? 1/dir[cmpt] : GREAT;
+  }
+  // The segment is shortened to the nearest intersection found so far
+  point nearestEnd = end;
+  scalar tMax = 1;
+  label nodeI = 0;
+  while (nodeI < nodes_.size()) {
+    const node& nod = nodes_[nodeI];
+    if (!intersects(nod.bb_, start, invDir, tMax)) {
+      nodeI = nod.skip_;
+    } else if (nod.size_ > 0) {
+      for (label i = nod.start_; i < nod.start_ + nod.size_; i++) {
+        const label shapeI = indices_[i];
+        point pt;
+        if (fiOp(shapeI, start, nearestEnd, pt)) {
+          hitInfo.setHit();
+          hitInfo.setIndex(shapeI);
+          hitInfo.setPoint(pt);
+          if (findAny) {
+            return hitInfo;
+          }
+          nearestEnd = pt;
+          if (magSqrDir > VSMALL) {
+            tMax = ((pt - start) & dir)/magSqrDir;
+          }
+        }
+      }
+      nodeI = nod.skip_;
+    } else {
+      nodeI++;
+    }
+  }
+  return hitInfo;
+}
+
+
+template<class Type>
+mousse::pointIndexHit mousse::indexedBVH<Type>::findLine
+(
+  const point& start,
+  const point& end
+) const
+{
+  return findLine
+  (
+    start,
+    end,
+    false,
+    typename Type::findIntersectOp{shapeTree_}
+  );
+}
+
+
+template<class Type>
+mousse::pointIndexHit mousse::indexedBVH<Type>::findLineAny
+(
+  const point& start,
+  const point& end
+) const
+{
+  return findLine
+  (
+    start,
+    end,
+    true,
+    typename Type::findIntersectOp{shapeTree_}
+  );
+}
+
+
+template<class Type>
+mousse::List<mousse::pointIndexHit> mousse::indexedBVH<Type>::findLine
+(
+  const pointField& start,
+  const pointField& end
+) const
+{
+  List<pointIndexHit> hits{start.size()};
+  const typename Type::findIntersectOp fiOp{shapeTree_};
+  const labelList order{sampleOrder(start)};
+  FOR_ALL(order, orderI) {
+    const label i = order[orderI];
+    hits[i] = findLine(start[i], end[i], false, fiOp);
+  }
+  return hits;
+}
+
+
+template<class Type>
+mousse::List<mousse::pointIndexHit> mousse::indexedBVH<Type>::findLineAny
+(
+  const pointField& start,
+  const pointField& end
+) const
+{
+  List<pointIndexHit> hits{start.size()};
+  const typename Type::findIntersectOp fiOp{shapeTree_};
+  const labelList order{sampleOrder(start)};
+  FOR_ALL(order, orderI) {
+    const label i = order[orderI];
+    hits[i] = findLine(start[i], end[i], true, fiOp);
+  }
+  return hits;
+}
+
+
+template<class Type>
+mousse::labelList mousse::indexedBVH<Type>::findBox
+(
+  const treeBoundBox& searchBox
+) const
+{
+  DynamicList<label> elements;
+  label nodeI = 0;
+  while (nodeI < nodes_.size()) {
+    const node& nod = nodes_[nodeI];
+    if (!nod.bb_.overlaps(searchBox)) {
+      nodeI = nod.skip_;
+    } else if (nod.size_ > 0) {
+      for (label i = nod.start_; i < nod.start_ + nod.size_; i++) {
+        if (shapes().overlaps(indices_[i], searchBox)) {
+          elements.append(indices_[i]);
+        }
+      }
+      nodeI = nod.skip_;
+    } else {
+      nodeI++;
+    }
+  }
+  return labelList{elements.xfer()};
+}
+
+
+template<class Type>
+mousse::labelList mousse::indexedBVH<Type>::findSphere
+(
+  const point& centre,
+  const scalar radiusSqr
+) const
+{
+  DynamicList<label> elements;
+  label nodeI = 0;
+  while (nodeI < nodes_.size()) {
+    const node& nod = nodes_[nodeI];
+    if (distSqr(nod.bb_, centre) > radiusSqr) {
+      nodeI = nod.skip_;
+    } else if (nod.size_ > 0) {
+      for (label i = nod.start_; i < nod.start_ + nod.size_; i++) {
+        if (shapes().overlaps(indices_[i], centre, radiusSqr)) {
+          elements.append(indices_[i]);
+        }
+      }
+      nodeI = nod.skip_;
+    } else {
+      nodeI++;
+    }
+  }
+  return labelList{elements.xfer()};
+}
+
+
+template<class Type>
+mousse::label mousse::indexedBVH<Type>::findInside(const point& sample) const
+{
+  label nodeI = 0;
+  while (nodeI < nodes_.size()) {
+    const node& nod = nodes_[nodeI];
+    if (!nod.bb_.contains(sample)) {
+      nodeI = nod.skip_;
+    } else if (nod.size_ > 0) {
+      for (label i = nod.start_; i < nod.start_ + nod.size_; i++) {
+        if (shapes().contains(indices_[i], sample)) {
+          return indices_[i];
+        }
+      }
+      nodeI = nod.skip_;
+    } else {
+      nodeI++;
+    }
+  }
+  return -1;
+}
+
+
+template<class Type>
+mousse::labelList mousse::indexedBVH<Type>::findInside
+(
+  const pointField& samples
+) const
+{
+  labelList shapeIs{samples.size(), -1};
+  const labelList order{sampleOrder(samples)};
+  FOR_ALL(order, orderI) {
+    const label i = order[orderI];
+    shapeIs[i] = findInside(samples[i]);
+  }
+  return shapeIs;
+}
@@ -0,0 +1,137 @@
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+
+#include "space_filling_curve.hpp"
+#include "list_ops.hpp"
+
+
+// Static Data Members
+namespace mousse {
+
+template<>
+const char* NamedEnum<spaceFillingCurve::curveType, 2>::names[] =
+{
+  "morton",
+  "hilbert"
+};
+
+}
+
+const mousse::NamedEnum<mousse::spaceFillingCurve::curveType, 2>
+  mousse::spaceFillingCurve::curveTypeNames;
+
+
+// Constructors
+mousse::spaceFillingCurve::spaceFillingCurve
+(
+  const curveType curve,
+  const boundBox& bb
+)
+:
+  curve_{curve},
+  origin_{bb.min()},
+  scale_{0}
+{
+  // Isotropic scaling so that the curve does not stretch with the box
+  const scalar span = cmptMax(bb.span());
+  if (span > VSMALL) {
+    scale_ = ((uint64_t(1) << nBits) - 1)/span;
+  }
+}
+
+
+// Private Member Functions
+void mousse::spaceFillingCurve::quantise
+(
+  const point& pt,
+  uint64_t ix[3]
+) const
+{
+  const uint64_t maxI = (uint64_t(1) << nBits) - 1;
+  for (direction cmpt = 0; cmpt < 3; cmpt++) {
+    const scalar s = max(scale_*(pt[cmpt] - origin_[cmpt]), 0);
+    ix[cmpt] = min(static_cast<uint64_t>(s), maxI);
+  }
+}
+
+
+// Static Member Functions
+uint64_t mousse::spaceFillingCurve::mortonKey(const uint64_t ix[3])
+{
+  uint64_t key = 0;
+  for (label bit = nBits - 1; bit >= 0; bit--) {
+    for (direction cmpt = 0; cmpt < 3; cmpt++) {
+      key = (key << 1) | ((ix[cmpt] >> bit) & 1);
+    }
+  }
+  return key;
+}
+
+
+uint64_t mousse::spaceFillingCurve::hilbertKey(const uint64_t ix[3])
+{
+  uint64_t x[3] = {ix[0], ix[1], ix[2]};
+  const uint64_t M = uint64_t(1) << (nBits - 1);
+  // Inverse undo excess work
+  for (uint64_t Q = M; Q > 1; Q >>= 1) {
+    const uint64_t P = Q - 1;
+    for (direction i = 0; i < 3; i++) {
+      if (x[i] & Q) {
+        // Invert
+        x[0] ^= P;
+      } else {
+        // Exchange
+        const uint64_t t = (x[0] ^ x[i]) & P;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+  // Gray encode
+  x[1] ^= x[0];
+  x[2] ^= x[1];
+  uint64_t t = 0;
+  for (uint64_t Q = M; Q > 1; Q >>= 1) {
+    if (x[2] & Q) {
+      t ^= Q - 1;
+    }
+  }
+  x[0] ^= t;
+  x[1] ^= t;
+  x[2] ^= t;
+  // The transposed coordinates interleave into the Hilbert index
+  return mortonKey(x);
+}
+
+
+// Member Functions
+uint64_t mousse::spaceFillingCurve::key(const point& pt) const
+{
+  uint64_t ix[3];
+  quantise(pt, ix);
+  return curve_ == HILBERT ? hilbertKey(ix) : mortonKey(ix);
+}
+
+
+mousse::List<uint64_t> mousse::spaceFillingCurve::keys
+(
+  const UList<point>& pts
+) const
+{
+  List<uint64_t> k{pts.size()};
+  FOR_ALL(pts, i) {
+    k[i] = key(pts[i]);
+  }
+  return k;
+}
+
+
+mousse::labelList mousse::spaceFillingCurve::order
+(
+  const UList<point>& pts
+) const
+{
+  labelList visitOrder;
+  sortedOrder(keys(pts), visitOrder);
+  return visitOrder;
+}
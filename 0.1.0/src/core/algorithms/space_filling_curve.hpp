@@ -0,0 +1,81 @@
+#ifndef CORE_ALGORITHMS_SPACE_FILLING_CURVE_HPP_
+#define CORE_ALGORITHMS_SPACE_FILLING_CURVE_HPP_
+
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+// Class
+//   mousse::spaceFillingCurve
+// Description
+//   Maps points onto a 3D space-filling curve (Morton or Hilbert order).
+//   Points are quantised isotropically onto a 2^21 grid spanning the
+//   supplied bounding box and the grid coordinates are interleaved into a
+//   63-bit key. Sorting points by key gives a locality-preserving linear
+//   ordering; the Hilbert curve has no jumps between consecutive cells of
+//   the grid and therefore gives more compact segments than Morton order.
+//   Hilbert keys use the transpose algorithm of Skilling (2004).
+
+#include "named_enum.hpp"
+#include "point_field.hpp"
+#include "bound_box.hpp"
+
+
+namespace mousse {
+
+class spaceFillingCurve
+{
+public:
+  //- Supported curves
+  enum curveType
+  {
+    MORTON,
+    HILBERT
+  };
+
+  // Static data
+    //- Curve names
+    static const NamedEnum<curveType, 2> curveTypeNames;
+    //- Number of bits per coordinate direction
+    static const label nBits = 21;
+
+private:
+  // Private data
+    //- Curve to use
+    const curveType curve_;
+    //- Origin of the quantisation grid
+    const point origin_;
+    //- Inverse of the grid spacing
+    scalar scale_;
+
+  // Private Member Functions
+    //- Quantise a point to integer grid coordinates
+    void quantise(const point& pt, uint64_t ix[3]) const;
+
+public:
+  // Constructors
+    //- Construct for a curve spanning the bounding box
+    spaceFillingCurve(const curveType curve, const boundBox& bb);
+
+  // Static Member Functions
+    //- Interleave the bits of the grid coordinates into a Morton key
+    static uint64_t mortonKey(const uint64_t ix[3]);
+    //- Return the Hilbert key of the grid coordinates
+    static uint64_t hilbertKey(const uint64_t ix[3]);
+
+  // Member Functions
+    //- Return the curve type
+    curveType curve() const
+    {
+      return curve_;
+    }
+    //- Return the key of a point
+    uint64_t key(const point& pt) const;
+    //- Return the keys of a list of points
+    List<uint64_t> keys(const UList<point>& pts) const;
+    //- Return the order in which to visit the points along the curve,
+    //  i.e. from curve position back to original index
+    labelList order(const UList<point>& pts) const;
+};
+
+}  // namespace mousse
+
+#endif
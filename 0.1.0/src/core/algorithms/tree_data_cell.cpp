@@ -131,6 +131,15 @@ bool mousse::treeDataCell::overlaps
     return cubeBb.overlaps(calcCellBb(cellLabels_[index]));
   }
 }
+bool mousse::treeDataCell::overlaps
+(
+  const label index,
+  const point& centre,
+  const scalar radiusSqr
+) const
+{
+  return shapeBb(index).overlaps(centre, radiusSqr);
+}
 bool mousse::treeDataCell::contains
 (
   const label index,
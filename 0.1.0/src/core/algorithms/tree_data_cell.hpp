@@ -122,6 +122,11 @@ public:
       //- Get representative point cloud for all shapes inside
       //  (one point per shape)
       pointField shapePoints() const;
+      //- Bounding box of the shape at index
+      inline treeBoundBox shapeBb(const label index) const
+      {
+        return cacheBb_ ? bbs_[index] : calcCellBb(cellLabels_[index]);
+      }
     // Search
       //- Get type (inside,outside,mixed,unknown) of point w.r.t. surface.
       //  Only makes sense for closed surfaces.
@@ -144,6 +149,13 @@ public:
         const label index,
         const treeBoundBox& sampleBb
       ) const;
+      //- Does (bb of) shape at index overlap the sphere
+      bool overlaps
+      (
+        const label index,
+        const point& centre,
+        const scalar radiusSqr
+      ) const;
       //- Does shape at index contain sample
       bool contains
       (
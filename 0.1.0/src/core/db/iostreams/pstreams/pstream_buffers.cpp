@@ -112,6 +112,100 @@ void mousse::PstreamBuffers::finishedSends(labelListList& sizes, const bool bloc
 }
 
 
+void mousse::PstreamBuffers::finishedNeighbourSends
+(
+  const labelUList& neighProcs,
+  labelList& recvSizes,
+  const bool block
+)
+{
+  finishedSendsCalled_ = true;
+  if (commsType_ != UPstream::nonBlocking) {
+    FATAL_ERROR_IN
+    (
+      "PstreamBuffers::finishedNeighbourSends"
+      "(const labelUList&, labelList&, const bool)"
+    )
+    << "Neighbour exchange not supported in "
+    << UPstream::commsTypeNames[commsType_] << endl
+    << " since transfers already in progress. Use non-blocking instead."
+    << exit(FatalError);
+  }
+  recvSizes.setSize(UPstream::nProcs(comm_));
+  recvSizes = 0;
+  // Send sizes to the neighbours only
+  labelList sendSizes{neighProcs.size()};
+  label startOfRequests = Pstream::nRequests();
+  FOR_ALL(neighProcs, i) {
+    const label procI = neighProcs[i];
+    sendSizes[i] = sendBuf_[procI].size();
+    UIPstream::read
+    (
+      UPstream::nonBlocking,
+      procI,
+      reinterpret_cast<char*>(&recvSizes[procI]),
+      sizeof(label),
+      tag_,
+      comm_
+    );
+  }
+  FOR_ALL(neighProcs, i) {
+    UOPstream::write
+    (
+      UPstream::nonBlocking,
+      neighProcs[i],
+      reinterpret_cast<const char*>(&sendSizes[i]),
+      sizeof(label),
+      tag_,
+      comm_
+    );
+  }
+  Pstream::waitRequests(startOfRequests);
+  // Exchange the data
+  startOfRequests = Pstream::nRequests();
+  FOR_ALL(neighProcs, i) {
+    const label procI = neighProcs[i];
+    if (recvSizes[procI] > 0) {
+      recvBuf_[procI].setSize(recvSizes[procI]);
+      UIPstream::read
+      (
+        UPstream::nonBlocking,
+        procI,
+        recvBuf_[procI].begin(),
+        recvSizes[procI],
+        tag_,
+        comm_
+      );
+    }
+  }
+  FOR_ALL(neighProcs, i) {
+    const label procI = neighProcs[i];
+    if (sendBuf_[procI].size() > 0
+        && !UOPstream::write
+        (
+          UPstream::nonBlocking,
+          procI,
+          sendBuf_[procI].begin(),
+          sendBuf_[procI].size(),
+          tag_,
+          comm_
+        )) {
+      FATAL_ERROR_IN
+      (
+        "PstreamBuffers::finishedNeighbourSends"
+        "(const labelUList&, labelList&, const bool)"
+      )
+      << "Cannot send outgoing message. "
+      << "to:" << procI << " nBytes:" << sendBuf_[procI].size()
+      << mousse::abort(FatalError);
+    }
+  }
+  if (block) {
+    Pstream::waitRequests(startOfRequests);
+  }
+}
+
+
 void mousse::PstreamBuffers::clear()
 {
   FOR_ALL(sendBuf_, i) {
@@ -90,7 +90,18 @@ public:
     //  sizes (bytes) transferred. Note:currently only valid for
     //  non-blocking.
     void finishedSends(labelListList& sizes, const bool block = true);
-    //- Clear storage and reset
+    //- Mark all sends as having been done, exchanging the sizes with
+    //  the given neighbour processors only instead of all processors.
+    //  Data may only be sent to and received from these neighbours.
+    //  Returns the sizes (bytes) received from every processor. Note:
+    //  only valid for non-blocking.
+    void finishedNeighbourSends
+    (
+      const labelUList& neighProcs,
+      labelList& recvSizes,
+      const bool block = true
+    );
+    //- Clear storage and reset, keeping the allocated buffers
     void clear();
 };
 }  // namespace mousse
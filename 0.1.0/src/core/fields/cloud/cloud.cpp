@@ -29,7 +29,8 @@ mousse::cloud::cloud(const objectRegistry& obr, const word& cloudName)
       IOobject::NO_READ,
       IOobject::AUTO_WRITE
     }
-  }
+  },
+  trackingTime_{0}
 {}
 
 
@@ -43,3 +44,27 @@ void mousse::cloud::autoMap(const mapPolyMesh&)
 {
   NOT_IMPLEMENTED("cloud::autoMap(const mapPolyMesh&)");
 }
+
+
+bool mousse::cloud::redistributable() const
+{
+  return false;
+}
+
+
+void mousse::cloud::prepareRedistribute()
+{
+  NOT_IMPLEMENTED("cloud::prepareRedistribute()");
+}
+
+
+void mousse::cloud::redistribute(const mapDistributePolyMesh&)
+{
+  NOT_IMPLEMENTED("cloud::redistribute(const mapDistributePolyMesh&)");
+}
+
+
+void mousse::cloud::countCellParticles(labelList&) const
+{
+  NOT_IMPLEMENTED("cloud::countCellParticles(labelList&) const");
+}
@@ -16,11 +16,17 @@ namespace mousse {
 
 // Forward declaration of classes
 class mapPolyMesh;
+class mapDistributePolyMesh;
 
 class cloud
 :
   public objectRegistry
 {
+  // Private data
+
+    //- CPU time spent moving the particles since the last reset
+    scalar trackingTime_;
+
 public:
 
   //- Runtime type information
@@ -54,6 +60,40 @@ public:
       //  mesh topology change
       virtual void autoMap(const mapPolyMesh&);
 
+      //- Can the cloud follow a redistribution of the mesh
+      virtual bool redistributable() const;
+
+      //- Remove the particles from the mesh and hold them until the
+      //  mesh has been redistributed
+      virtual void prepareRedistribute();
+
+      //- Send the held particles to the processors their cells were
+      //  moved to and insert them into the redistributed mesh
+      virtual void redistribute(const mapDistributePolyMesh&);
+
+    // Access
+
+      //- Add the number of particles in every cell to nCellParticles
+      virtual void countCellParticles(labelList& nCellParticles) const;
+
+      //- CPU time spent moving the particles since the last reset
+      scalar trackingTime() const
+      {
+        return trackingTime_;
+      }
+
+      //- Add to the tracking time
+      void addTrackingTime(const scalar t)
+      {
+        trackingTime_ += t;
+      }
+
+      //- Reset the tracking time
+      void resetTrackingTime()
+      {
+        trackingTime_ = 0;
+      }
+
 };
 
 }  // namespace mousse
@@ -169,6 +169,12 @@ public:
         const point& pt,
         List<scalar>& bary
       ) const;
+      //- As above, without allocating storage for the coordinates
+      inline scalar barycentric
+      (
+        const point& pt,
+        FixedList<scalar, 4>& bary
+      ) const;
       //- Return nearest point to p on tetrahedron. Is p itself
       //  if inside.
       inline pointHit nearestPoint(const point& p) const;
@@ -497,6 +503,37 @@ mousse::scalar mousse::tetrahedron<Point, PointRef>::barycentric
 }
 
 
+template<class Point, class PointRef>
+inline mousse::scalar mousse::tetrahedron<Point, PointRef>::barycentric
+(
+  const point& pt,
+  FixedList<scalar, 4>& bary
+) const
+{
+  vector e0{a_ - d_};
+  vector e1{b_ - d_};
+  vector e2{c_ - d_};
+  tensor t
+  {
+    e0.x(), e1.x(), e2.x(),
+    e0.y(), e1.y(), e2.y(),
+    e0.z(), e1.z(), e2.z()
+  };
+  scalar detT = det(t);
+  if (mousse::mag(detT) < SMALL) {
+    // Degenerate tetrahedron, returning 1/4 barycentric coordinates.
+    bary = 0.25;
+    return detT;
+  }
+  vector res = inv(t, detT) & (pt - d_);
+  bary[0] = res.x();
+  bary[1] = res.y();
+  bary[2] = res.z();
+  bary[3] = (1.0 - res.x() - res.y() - res.z());
+  return detT;
+}
+
+
 template<class Point, class PointRef>
 inline mousse::pointHit mousse::tetrahedron<Point, PointRef>::nearestPoint
 (
@@ -0,0 +1,60 @@
+#ifndef DYNAMIC_MESH_POLY_TOPO_CHANGE_POLY_MESH_RENUMBER_HPP_
+#define DYNAMIC_MESH_POLY_TOPO_CHANGE_POLY_MESH_RENUMBER_HPP_
+
+// mousse: CFD toolbox
+// Copyright (C) 2011-2015 OpenFOAM Foundation
+// Copyright (C) 2016 mousse project
+// Class
+//   mousse::polyMeshRenumber
+// Description
+//   Helper functions to renumber the cells and internal faces of a polyMesh
+//   in-place, without going through polyTopoChange. Points and boundary
+//   faces keep their numbering.
+
+#include "label_list.hpp"
+#include "auto_ptr.hpp"
+
+
+namespace mousse {
+
+// Forward declaration of classes
+class primitiveMesh;
+class polyMesh;
+class mapPolyMesh;
+
+
+class polyMeshRenumber
+{
+public:
+  // Static Member Functions
+    //- Return the bandwidth of the owner/neighbour addressing
+    static label bandwidth
+    (
+      const labelUList& owner,
+      const labelUList& neighbour
+    );
+    //- Determine the upper-triangular order of the internal faces for the
+    //  cell order (new to old cell). Returns old face for every new face;
+    //  boundary faces are left in place.
+    static labelList faceOrder
+    (
+      const primitiveMesh& mesh,
+      const labelList& cellOrder
+    );
+    //- Reorder the mesh cells and faces.
+    //  cellOrder: old cell for every new cell
+    //  faceOrder: old face for every new face. Ordering of boundary faces
+    //  not changed.
+    //  Faces whose owner ends up higher than the neighbour are flipped.
+    //  Returns the map to update fields and other mesh data with.
+    static autoPtr<mapPolyMesh> reorder
+    (
+      polyMesh& mesh,
+      const labelList& cellOrder,
+      const labelList& faceOrder
+    );
+};
+
+}  // namespace mousse
+
+#endif
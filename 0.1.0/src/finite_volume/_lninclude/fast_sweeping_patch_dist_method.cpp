@@ -0,0 +1 @@
+../fv_mesh/wall_dist/patch_dist_methods/fast_sweeping_patch_dist_method.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+../interpolation/surface_interpolation/limited_schemes/limited_scheme_geometry.cpp
\ No newline at end of file
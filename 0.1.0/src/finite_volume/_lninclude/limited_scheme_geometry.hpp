@@ -0,0 +1 @@
+../interpolation/surface_interpolation/limited_schemes/limited_scheme_geometry.hpp
\ No newline at end of file
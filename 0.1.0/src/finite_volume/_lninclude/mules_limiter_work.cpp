@@ -0,0 +1 @@
+../fv_matrices/solvers/mules_limiter_work.cpp
\ No newline at end of file
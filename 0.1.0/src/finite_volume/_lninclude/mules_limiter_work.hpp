@@ -0,0 +1 @@
+../fv_matrices/solvers/mules_limiter_work.hpp
\ No newline at end of file
@@ -0,0 +1 @@
+../interpolation/interpolation/tet_point_weight.hpp
\ No newline at end of file
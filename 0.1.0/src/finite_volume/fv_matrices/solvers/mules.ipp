@@ -9,6 +9,7 @@
 #include "sliced_surface_fields.hpp"
 #include "wedge_fv_patch.hpp"
 #include "sync_tools.hpp"
+#include "mules_limiter_work.hpp"
 
 
 template<class RdeltaTType, class RhoType, class SpType, class SuType>
@@ -171,11 +172,19 @@ void mousse::MULES::limiter
   scalarField& lambdaIf = lambda;
   surfaceScalarField::GeometricBoundaryField& lambdaBf =
     lambda.boundaryField();
-  scalarField psiMaxn(psiIf.size(), psiMin);
-  scalarField psiMinn(psiIf.size(), psiMax);
-  scalarField sumPhiBD(psiIf.size(), 0.0);
-  scalarField sumPhip(psiIf.size(), VSMALL);
-  scalarField mSumPhim(psiIf.size(), VSMALL);
+  // Persistent work space, reused by all the limiter calls on the mesh
+  MULESLimiterWork& work = MULESLimiterWork::New(mesh);
+  List<MULESLimiterWork::faceFlux>& faceFluxes = work.faceFluxes;
+  scalarField& psiMaxn = work.psiMaxn;
+  scalarField& psiMinn = work.psiMinn;
+  scalarField& sumPhiBD = work.sumPhiBD;
+  scalarField& sumPhip = work.sumPhip;
+  scalarField& mSumPhim = work.mSumPhim;
+  psiMaxn = psiMin;
+  psiMinn = psiMax;
+  sumPhiBD = 0.0;
+  sumPhip = VSMALL;
+  mSumPhim = VSMALL;
   FOR_ALL(phiCorrIf, facei) {
     label own = owner[facei];
     label nei = neighb[facei];
@@ -186,12 +195,19 @@ void mousse::MULES::limiter
     sumPhiBD[own] += phiBDIf[facei];
     sumPhiBD[nei] -= phiBDIf[facei];
     scalar phiCorrf = phiCorrIf[facei];
+    MULESLimiterWork::faceFlux& ff = faceFluxes[facei];
     if (phiCorrf > 0.0) {
       sumPhip[own] += phiCorrf;
       mSumPhim[nei] += phiCorrf;
+      ff.from = own;
+      ff.to = nei;
+      ff.magPhiCorr = phiCorrf;
     } else {
       mSumPhim[own] -= phiCorrf;
       sumPhip[nei] -= phiCorrf;
+      ff.from = nei;
+      ff.to = own;
+      ff.magPhiCorr = -phiCorrf;
     }
   }
   FOR_ALL(phiCorrBf, patchi) {
@@ -224,8 +240,10 @@ void mousse::MULES::limiter
       }
     }
   }
-  psiMaxn = min(psiMaxn, psiMax);
-  psiMinn = max(psiMinn, psiMin);
+  FOR_ALL(psiMaxn, celli) {
+    psiMaxn[celli] = min(psiMaxn[celli], psiMax);
+    psiMinn[celli] = max(psiMinn[celli], psiMin);
+  }
   if (smoothLimiter > SMALL) {
     psiMaxn =
       min(smoothLimiter*psiIf + (1.0 - smoothLimiter)*psiMaxn, psiMax);
@@ -251,23 +269,22 @@ void mousse::MULES::limiter
          + (rho.oldTime().field()*rDeltaT)*psi0)
       - sumPhiBD;
   }
-  scalarField sumlPhip{psiIf.size()};
-  scalarField mSumlPhim{psiIf.size()};
+  scalarField& sumlPhip = work.sumlPhip;
+  scalarField& mSumlPhim = work.mSumlPhim;
+  scalarField& lambdam = work.lambdam;
+  scalarField& lambdap = work.lambdap;
+  // Sums of the limited internal face fluxes for the first iteration. In
+  // the following iterations they are accumulated in the same pass over
+  // the faces that updates the limiter.
+  sumlPhip = 0.0;
+  mSumlPhim = 0.0;
+  FOR_ALL(faceFluxes, facei) {
+    const MULESLimiterWork::faceFlux& ff = faceFluxes[facei];
+    scalar lambdaPhiCorrf = lambdaIf[facei]*ff.magPhiCorr;
+    sumlPhip[ff.from] += lambdaPhiCorrf;
+    mSumlPhim[ff.to] += lambdaPhiCorrf;
+  }
   for (int j=0; j<nLimiterIter; j++) {
-    sumlPhip = 0.0;
-    mSumlPhim = 0.0;
-    FOR_ALL(lambdaIf, facei) {
-      label own = owner[facei];
-      label nei = neighb[facei];
-      scalar lambdaPhiCorrf = lambdaIf[facei]*phiCorrIf[facei];
-      if (lambdaPhiCorrf > 0.0) {
-        sumlPhip[own] += lambdaPhiCorrf;
-        mSumlPhim[nei] += lambdaPhiCorrf;
-      } else {
-        mSumlPhim[own] -= lambdaPhiCorrf;
-        sumlPhip[nei] -= lambdaPhiCorrf;
-      }
-    }
     FOR_ALL(lambdaBf, patchi) {
       scalarField& lambdaPf = lambdaBf[patchi];
       const scalarField& phiCorrfPf = phiCorrBf[patchi];
@@ -283,7 +300,7 @@ void mousse::MULES::limiter
       }
     }
     FOR_ALL(sumlPhip, celli) {
-      sumlPhip[celli] =
+      lambdam[celli] =
         max
         (
           min
@@ -293,7 +310,7 @@ void mousse::MULES::limiter
           ),
           0.0
         );
-      mSumlPhim[celli] =
+      lambdap[celli] =
         max
         (
           min
@@ -303,22 +320,18 @@ void mousse::MULES::limiter
           ),
           0.0
         );
+      sumlPhip[celli] = 0.0;
+      mSumlPhim[celli] = 0.0;
     }
-    const scalarField& lambdam = sumlPhip;
-    const scalarField& lambdap = mSumlPhim;
-    FOR_ALL(lambdaIf, facei) {
-      if (phiCorrIf[facei] > 0.0) {
-        lambdaIf[facei] = min
-        (
-          lambdaIf[facei],
-          min(lambdap[owner[facei]], lambdam[neighb[facei]])
-        );
-      } else {
-        lambdaIf[facei] = min
-        (
-          lambdaIf[facei],
-          min(lambdam[owner[facei]], lambdap[neighb[facei]])
-        );
+    const bool nextIter = j < nLimiterIter - 1;
+    FOR_ALL(faceFluxes, facei) {
+      const MULESLimiterWork::faceFlux& ff = faceFluxes[facei];
+      scalar& lambdaf = lambdaIf[facei];
+      lambdaf = min(lambdaf, min(lambdap[ff.from], lambdam[ff.to]));
+      if (nextIter) {
+        scalar lambdaPhiCorrf = lambdaf*ff.magPhiCorr;
+        sumlPhip[ff.from] += lambdaPhiCorrf;
+        mSumlPhim[ff.to] += lambdaPhiCorrf;
       }
     }
     FOR_ALL(lambdaBf, patchi) {
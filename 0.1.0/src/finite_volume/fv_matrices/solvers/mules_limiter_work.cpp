@@ -0,0 +1,39 @@
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+
+#include "mules_limiter_work.hpp"
+
+
+// Static Data Members
+namespace mousse {
+
+DEFINE_TYPE_NAME_AND_DEBUG(MULESLimiterWork, 0);
+
+}
+
+
+// Constructors
+mousse::MULESLimiterWork::MULESLimiterWork(const fvMesh& mesh)
+:
+  MeshObject<fvMesh, mousse::TopologicalMeshObject, MULESLimiterWork>{mesh},
+  faceFluxes{mesh.nInternalFaces()},
+  psiMaxn{mesh.nCells()},
+  psiMinn{mesh.nCells()},
+  sumPhiBD{mesh.nCells()},
+  sumPhip{mesh.nCells()},
+  mSumPhim{mesh.nCells()},
+  sumlPhip{mesh.nCells()},
+  mSumlPhim{mesh.nCells()},
+  lambdam{mesh.nCells()},
+  lambdap{mesh.nCells()}
+{
+  if (debug) {
+    Info << "MULESLimiterWork::MULESLimiterWork(const fvMesh&) : "
+      << "Allocating MULES limiter work space" << endl;
+  }
+}
+
+
+// Destructor
+mousse::MULESLimiterWork::~MULESLimiterWork()
+{}
@@ -0,0 +1,91 @@
+#ifndef FINITE_VOLUME_FV_MATRICES_SOLVERS_MULES_LIMITER_WORK_HPP_
+#define FINITE_VOLUME_FV_MATRICES_SOLVERS_MULES_LIMITER_WORK_HPP_
+
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+// Class
+//   mousse::MULESLimiterWork
+// Description
+//   Per-mesh work space of the MULES limiter.
+//   The cell work arrays are allocated once and reused by every limiter
+//   call instead of being rebuilt for each corrector.  The internal faces
+//   are packed into a single list holding the upwind and downwind cell of
+//   the correction flux and its magnitude, so that the limiter iterations
+//   stream through one array without re-testing the flux direction.
+//   The work space is deleted on topology change.
+
+#include "_mesh_object.hpp"
+#include "fv_mesh.hpp"
+
+
+namespace mousse {
+
+class MULESLimiterWork
+:
+  public MeshObject<fvMesh, TopologicalMeshObject, MULESLimiterWork>
+{
+public:
+  //- Correction flux of an internal face
+  struct faceFlux
+  {
+    //- Cell the correction flux leaves
+    label from;
+    //- Cell the correction flux enters
+    label to;
+    //- Magnitude of the correction flux
+    scalar magPhiCorr;
+  };
+
+  // Public data
+    //- Packed correction fluxes of the internal faces in face order
+    List<faceFlux> faceFluxes;
+    //- Maximum allowed increase of every cell
+    scalarField psiMaxn;
+    //- Maximum allowed decrease of every cell
+    scalarField psiMinn;
+    //- Net bounded flux of every cell
+    scalarField sumPhiBD;
+    //- Sum of the outgoing correction fluxes of every cell
+    scalarField sumPhip;
+    //- Sum of the incoming correction fluxes of every cell
+    scalarField mSumPhim;
+    //- Sum of the limited outgoing correction fluxes of every cell
+    scalarField sumlPhip;
+    //- Sum of the limited incoming correction fluxes of every cell
+    scalarField mSumlPhim;
+    //- Limiter of the incoming fluxes of every cell
+    scalarField lambdam;
+    //- Limiter of the outgoing fluxes of every cell
+    scalarField lambdap;
+
+  TYPE_NAME("MULESLimiterWork");
+
+  // Constructors
+    explicit MULESLimiterWork(const fvMesh& mesh);
+
+    //- Disallow default bitwise copy construct
+    MULESLimiterWork(const MULESLimiterWork&) = delete;
+
+    //- Disallow default bitwise assignment
+    MULESLimiterWork& operator=(const MULESLimiterWork&) = delete;
+
+  //- Destructor
+  virtual ~MULESLimiterWork();
+
+  // Member functions
+    //- Return the work space of the mesh for modification
+    static MULESLimiterWork& New(const fvMesh& mesh)
+    {
+      return const_cast<MULESLimiterWork&>
+      (
+        MeshObject<fvMesh, TopologicalMeshObject, MULESLimiterWork>::New
+        (
+          mesh
+        )
+      );
+    }
+};
+
+}  // namespace mousse
+
+#endif
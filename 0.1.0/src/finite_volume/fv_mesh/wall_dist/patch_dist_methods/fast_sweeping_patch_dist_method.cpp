@@ -0,0 +1,236 @@
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+
+#include "fast_sweeping_patch_dist_method.hpp"
+#include "fv_mesh.hpp"
+#include "vol_fields.hpp"
+#include "sync_tools.hpp"
+#include "empty_fv_patch_fields.hpp"
+#include "add_to_run_time_selection_table.hpp"
+
+// Static Data Members
+namespace mousse
+{
+namespace patchDistMethods
+{
+  DEFINE_TYPE_NAME_AND_DEBUG(fastSweeping, 0);
+  ADD_TO_RUN_TIME_SELECTION_TABLE(patchDistMethod, fastSweeping, dictionary);
+}
+}
+
+// Private Member Functions
+bool mousse::patchDistMethods::fastSweeping::updateCell
+(
+  const label cellI,
+  const pointField& nbrNearest,
+  pointField& nearest,
+  scalarField& distSqr
+) const
+{
+  const point& cc = mesh_.cellCentres()[cellI];
+  const labelList& own = mesh_.faceOwner();
+  const labelList& nei = mesh_.faceNeighbour();
+  const cell& cFaces = mesh_.cells()[cellI];
+  bool changed = false;
+  FOR_ALL(cFaces, i)
+  {
+    const label faceI = cFaces[i];
+    // Uncoupled boundary faces hold the nearest point of the cell itself
+    const point& nbrPt =
+      mesh_.isInternalFace(faceI)
+     ? nearest[own[faceI] == cellI ? nei[faceI] : own[faceI]]
+     : nbrNearest[faceI - mesh_.nInternalFaces()];
+    const scalar d2 = magSqr(nbrPt - cc);
+    if (d2 < distSqr[cellI])
+    {
+      distSqr[cellI] = d2;
+      nearest[cellI] = nbrPt;
+      changed = true;
+    }
+  }
+  return changed;
+}
+
+
+mousse::tmp<mousse::scalarField>
+mousse::patchDistMethods::fastSweeping::calcNearest(pointField& nearest) const
+{
+  const pointField& cc = mesh_.cellCentres();
+  const pointField& points = mesh_.points();
+  const faceList& faces = mesh_.faces();
+  const labelListList& pointCells = mesh_.pointCells();
+  const polyBoundaryMesh& pbm = mesh_.boundaryMesh();
+  // Unset cells are far enough from their unset neighbours that these
+  // never become nearer
+  nearest.setSize(mesh_.nCells());
+  nearest = point(GREAT, GREAT, GREAT);
+  tmp<scalarField> tdistSqr{new scalarField{mesh_.nCells(), GREAT}};
+  scalarField& distSqr = tdistSqr();
+  // Exact nearest points of the cells sharing a point with a patch face
+  FOR_ALL_CONST_ITER(labelHashSet, patchIDs_, iter)
+  {
+    const polyPatch& pp = pbm[iter.key()];
+    FOR_ALL(pp, i)
+    {
+      const face& f = faces[pp.start() + i];
+      FOR_ALL(f, fp)
+      {
+        const labelList& pCells = pointCells[f[fp]];
+        FOR_ALL(pCells, j)
+        {
+          const label cellI = pCells[j];
+          const point nearPt = f.nearestPoint(cc[cellI], points).rawPoint();
+          const scalar d2 = magSqr(nearPt - cc[cellI]);
+          if (d2 < distSqr[cellI])
+          {
+            distSqr[cellI] = d2;
+            nearest[cellI] = nearPt;
+          }
+        }
+      }
+    }
+  }
+  // Cells ordered along the diagonals
+  FixedList<vector, 4> dirs;
+  dirs[0] = vector{1, 1, 1};
+  dirs[1] = vector{1, 1, -1};
+  dirs[2] = vector{1, -1, 1};
+  dirs[3] = vector{-1, 1, 1};
+  List<labelList> orders{dirs.size()};
+  FOR_ALL(dirs, dirI)
+  {
+    sortedOrder(scalarField{cc & dirs[dirI]}, orders[dirI]);
+  }
+  // Nearest points of the cells on the other side of the boundary faces
+  pointField nbrNearest{mesh_.nFaces() - mesh_.nInternalFaces()};
+  label iter = 0;
+  label nChanged = 0;
+  do
+  {
+    syncTools::swapBoundaryCellPositions(mesh_, nearest, nbrNearest);
+    nChanged = 0;
+    FOR_ALL(orders, dirI)
+    {
+      const labelList& order = orders[dirI];
+      FOR_ALL(order, i)
+      {
+        if (updateCell(order[i], nbrNearest, nearest, distSqr))
+        {
+          nChanged++;
+        }
+      }
+      FOR_ALL_REVERSE(order, i)
+      {
+        if (updateCell(order[i], nbrNearest, nearest, distSqr))
+        {
+          nChanged++;
+        }
+      }
+    }
+    reduce(nChanged, sumOp<label>());
+    iter++;
+    if (debug)
+    {
+      Info << "fastSweeping : iteration " << iter << " changed "
+        << nChanged << " cells" << endl;
+    }
+  } while (nChanged > 0 && iter < maxIter_);
+  nUnset_ = 0;
+  FOR_ALL(distSqr, cellI)
+  {
+    if (distSqr[cellI] >= GREAT)
+    {
+      nUnset_++;
+    }
+  }
+  return tdistSqr;
+}
+
+
+// Constructors
+mousse::patchDistMethods::fastSweeping::fastSweeping
+(
+  const dictionary& dict,
+  const fvMesh& mesh,
+  const labelHashSet& patchIDs
+)
+:
+  patchDistMethod{mesh, patchIDs},
+  maxIter_{dict.lookupOrDefault<label>("maxIter", 100)},
+  nUnset_{0}
+{}
+mousse::patchDistMethods::fastSweeping::fastSweeping
+(
+  const fvMesh& mesh,
+  const labelHashSet& patchIDs
+)
+:
+  patchDistMethod{mesh, patchIDs},
+  maxIter_{100},
+  nUnset_{0}
+{}
+
+// Member Functions
+bool mousse::patchDistMethods::fastSweeping::correct(volScalarField& y)
+{
+  return correct(y, const_cast<volVectorField&>(volVectorField::null()));
+}
+bool mousse::patchDistMethods::fastSweeping::correct
+(
+  volScalarField& y,
+  volVectorField& n
+)
+{
+  const pointField& cc = mesh_.cellCentres();
+  pointField nearest;
+  const scalarField distSqr{calcNearest(nearest)};
+  scalarField& yIn = y.internalField();
+  FOR_ALL(yIn, cellI)
+  {
+    yIn[cellI] = distSqr[cellI] < GREAT ? sqrt(distSqr[cellI]) : GREAT;
+  }
+  // Patch values from the nearest point of the face cells
+  FOR_ALL(y.boundaryField(), patchI)
+  {
+    fvPatchScalarField& yp = y.boundaryField()[patchI];
+    if (isA<emptyFvPatchScalarField>(yp))
+    {
+      continue;
+    }
+    if (patchIDs_.found(patchI))
+    {
+      yp == 0;
+    }
+    else
+    {
+      const labelUList& faceCells = yp.patch().faceCells();
+      const vectorField& Cf = yp.patch().Cf();
+      FOR_ALL(yp, i)
+      {
+        yp[i] = mag(nearest[faceCells[i]] - Cf[i]);
+      }
+    }
+  }
+  // Only calculate n if the field is defined
+  if (notNull(n))
+  {
+    vectorField& nIn = n.internalField();
+    FOR_ALL(nIn, cellI)
+    {
+      const vector d = nearest[cellI] - cc[cellI];
+      const scalar magD = mag(d);
+      nIn[cellI] =
+        magD > VSMALL && distSqr[cellI] < GREAT ? d/magD : vector::zero;
+    }
+    // The patch normals of the patches are kept
+    FOR_ALL(n.boundaryField(), patchI)
+    {
+      fvPatchVectorField& np = n.boundaryField()[patchI];
+      if (!patchIDs_.found(patchI) && !isA<emptyFvPatchVectorField>(np))
+      {
+        np == np.patchInternalField();
+      }
+    }
+  }
+  return true;
+}
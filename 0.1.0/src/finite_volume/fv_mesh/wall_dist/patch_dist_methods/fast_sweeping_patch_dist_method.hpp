@@ -0,0 +1,101 @@
+#ifndef FINITE_VOLUME_FV_MESH_WALL_DIST_PATCH_DIST_METHODS_FAST_SWEEPING_PATCH_DIST_METHOD_HPP_
+#define FINITE_VOLUME_FV_MESH_WALL_DIST_PATCH_DIST_METHODS_FAST_SWEEPING_PATCH_DIST_METHOD_HPP_
+
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+// Class
+//   mousse::patchDistMethods::fastSweeping
+// Description
+//   Fast-sweeping method for calculating the distance to nearest patch for
+//   all cells and boundary.
+//   Every cell holds the nearest patch point found so far. The cells next
+//   to the patches (sharing a point with a patch face) are initialised
+//   with the exact nearest point on those faces. The nearest points are
+//   then propagated between face neighbours in Gauss-Seidel sweeps over
+//   the cells ordered forwards and backwards along the four diagonals of
+//   the bounding box, so that a nearest point usually crosses the domain
+//   in one set of sweeps. In parallel the nearest points of the cells on
+//   the other side of the coupled patches are exchanged after every set
+//   of sweeps until nothing changes.
+//   Unlike meshWave the distance is the Euclidean distance to the
+//   propagated nearest point, so is not affected by mesh skewness, and no
+//   linear system has to be solved as for Poisson.
+//   Example of the wallDist specification in fvSchemes:
+//   \verbatim
+//     wallDist
+//     {
+//       method fastSweeping;
+//       // Optional maximum number of sets of sweeps
+//       maxIter 100;
+//       // Optional entry enabling the calculation
+//       // of the normal-to-wall field
+//       nRequired false;
+//     }
+//   \endverbatim
+// SeeAlso
+//   mousse::patchDistMethod::meshWave
+//   mousse::wallDist
+// SourceFiles
+//   fast_sweeping_patch_dist_method.cpp
+#include "patch_dist_method.hpp"
+namespace mousse
+{
+namespace patchDistMethods
+{
+class fastSweeping
+:
+  public patchDistMethod
+{
+  // Private Member Data
+    //- Maximum number of sets of sweeps
+    const label maxIter_;
+    //- Number of unset cells
+    mutable label nUnset_;
+  // Private Member Functions
+    //- Calculate the nearest patch point of every cell. Returns the
+    //  squared distances.
+    tmp<scalarField> calcNearest(pointField& nearest) const;
+    //- Update the nearest patch point of a cell from its neighbours.
+    //  Returns whether it has changed.
+    bool updateCell
+    (
+      const label cellI,
+      const pointField& nbrNearest,
+      pointField& nearest,
+      scalarField& distSqr
+    ) const;
+public:
+  //- Runtime type information
+  TYPE_NAME("fastSweeping");
+  // Constructors
+    //- Construct from coefficients dictionary, mesh
+    //  and fixed-value patch set
+    fastSweeping
+    (
+      const dictionary& dict,
+      const fvMesh& mesh,
+      const labelHashSet& patchIDs
+    );
+    //- Construct from mesh and fixed-value patch set
+    fastSweeping
+    (
+      const fvMesh& mesh,
+      const labelHashSet& patchIDs
+    );
+    //- Disallow default bitwise copy construct
+    fastSweeping(const fastSweeping&) = delete;
+    //- Disallow default bitwise assignment
+    fastSweeping& operator=(const fastSweeping&) = delete;
+  // Member Functions
+    label nUnset() const
+    {
+      return nUnset_;
+    }
+    //- Correct the given distance-to-patch field
+    virtual bool correct(volScalarField& y);
+    //- Correct the given distance-to-patch and normal-to-patch fields
+    virtual bool correct(volScalarField& y, volVectorField& n);
+};
+}  // namespace patchDistMethods
+}  // namespace mousse
+#endif
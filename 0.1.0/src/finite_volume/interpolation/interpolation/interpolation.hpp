@@ -16,6 +16,7 @@
 #include "auto_ptr.hpp"
 #include "run_time_selection_tables.hpp"
 #include "tet_indices.hpp"
+#include "tet_point_weight.hpp"
 
 
 namespace mousse {
@@ -96,6 +97,14 @@ public:
     {
       return interpolate(position, tetIs.cell(), faceI);
     }
+    //- Interpolate field with the precomputed weights of a position in
+    //  a tetrahedron.  Calls the tetIndices interpolate function above
+    //  except where overridden by derived interpolation types that use
+    //  the weights.
+    virtual Type interpolate(const tetPointWeight& tpw) const
+    {
+      return interpolate(tpw.position(), tpw.tetIs());
+    }
 };
 }  // namespace mousse
 
@@ -37,6 +37,8 @@ public:
   // Member Functions
     //- Interpolate field for the given cellPointWeight
     inline Type interpolate(const cellPointWeight& cpw) const;
+    //- Interpolate field for the given tetPointWeight
+    inline Type interpolate(const tetPointWeight& tpw) const;
     //- Interpolate field to the given point in the given cell
     inline Type interpolate
     (
@@ -73,6 +75,22 @@ inline Type mousse::interpolationCellPoint<Type>::interpolate
 }
 
 
+template<class Type>
+inline Type mousse::interpolationCellPoint<Type>::interpolate
+(
+  const tetPointWeight& tpw
+) const
+{
+  const FixedList<scalar, 4>& weights = tpw.weights();
+  const FixedList<label, 3>& faceVertices = tpw.faceVertices();
+  Type t = this->psi_[tpw.cell()]*weights[0];
+  t += psip_[faceVertices[0]]*weights[1];
+  t += psip_[faceVertices[1]]*weights[2];
+  t += psip_[faceVertices[2]]*weights[3];
+  return t;
+}
+
+
 template<class Type>
 inline Type mousse::interpolationCellPoint<Type>::interpolate
 (
@@ -113,7 +131,7 @@ inline Type mousse::interpolationCellPoint<Type>::interpolate
       << exit(FatalError);
     }
   }
-  List<scalar> weights;
+  FixedList<scalar, 4> weights;
   tetIs.tet(this->pMesh_).barycentric(position, weights);
   const faceList& pFaces = this->pMesh_.faces();
   const face& f = pFaces[tetIs.face()];
@@ -0,0 +1,98 @@
+#ifndef FINITE_VOLUME_INTERPOLATION_INTERPOLATION_TET_POINT_WEIGHT_HPP_
+#define FINITE_VOLUME_INTERPOLATION_INTERPOLATION_TET_POINT_WEIGHT_HPP_
+
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+// Class
+//   mousse::tetPointWeight
+// Description
+//   Barycentric weights of a position in the tetrahedron given by a
+//   tetIndices, i.e. (cellCentre, faceBasePt, facePtA, facePtB).
+//   Evaluated once per position and shared by the interpolators of all
+//   the fields sampled there, instead of every interpolator locating the
+//   tetrahedron and solving for the weights again.
+
+#include "tet_indices.hpp"
+#include "fixed_list.hpp"
+
+
+namespace mousse {
+
+class tetPointWeight
+{
+  // Private data
+    //- Position
+    point position_;
+    //- Tetrahedron containing the position
+    tetIndices tetIs_;
+    //- Weights applied to the tet vertices
+    FixedList<scalar, 4> weights_;
+    //- Mesh point indices of the tet face vertices
+    FixedList<label, 3> faceVertices_;
+public:
+  // Constructors
+    //- Construct null
+    tetPointWeight()
+    :
+      position_{point::zero},
+      tetIs_{},
+      weights_{scalar(0)},
+      faceVertices_{-1}
+    {}
+    //- Construct for the position in the tetrahedron
+    tetPointWeight
+    (
+      const polyMesh& mesh,
+      const point& position,
+      const tetIndices& tetIs
+    )
+    {
+      set(mesh, position, tetIs);
+    }
+  // Member Functions
+    //- Evaluate the weights of the position in the tetrahedron
+    inline void set
+    (
+      const polyMesh& mesh,
+      const point& position,
+      const tetIndices& tetIs
+    )
+    {
+      position_ = position;
+      tetIs_ = tetIs;
+      tetIs.tet(mesh).barycentric(position, weights_);
+      const face& f = mesh.faces()[tetIs.face()];
+      faceVertices_[0] = f[tetIs.faceBasePt()];
+      faceVertices_[1] = f[tetIs.facePtA()];
+      faceVertices_[2] = f[tetIs.facePtB()];
+    }
+    //- Position
+    inline const point& position() const
+    {
+      return position_;
+    }
+    //- Tetrahedron indices
+    inline const tetIndices& tetIs() const
+    {
+      return tetIs_;
+    }
+    //- Cell index
+    inline label cell() const
+    {
+      return tetIs_.cell();
+    }
+    //- Interpolation weights
+    inline const FixedList<scalar, 4>& weights() const
+    {
+      return weights_;
+    }
+    //- Interpolation addressing for points on face
+    inline const FixedList<label, 3>& faceVertices() const
+    {
+      return faceVertices_;
+    }
+};
+
+}  // namespace mousse
+
+#endif
@@ -6,6 +6,7 @@
 #include "surface_fields.hpp"
 #include "fvc_grad.hpp"
 #include "coupled_fv_patch_fields.hpp"
+#include "limited_scheme_geometry.hpp"
 
 
 // Private Member Functions 
@@ -26,22 +27,24 @@ void mousse::LimitedScheme<Type, Limiter, LimitFunc>::calcLimiter
   const GeometricField<typename Limiter::gradPhiType, fvPatchField, volMesh>&
     gradc = tgradc();
   const surfaceScalarField& CDweights = mesh.surfaceInterpolation::weights();
-  const labelUList& owner = mesh.owner();
-  const labelUList& neighbour = mesh.neighbour();
-  const vectorField& C = mesh.C();
+  // Stream through the packed face stencil rather than gathering the
+  // weights and cell centres face by face
+  const limitedSchemeGeometry& geometry = limitedSchemeGeometry::New(mesh);
+  const List<limitedSchemeGeometry::faceStencil>& stencil =
+    geometry.stencil();
+  const scalarField& faceFlux = this->faceFlux_.internalField();
   scalarField& pLim = limiterField.internalField();
   FOR_ALL(pLim, face) {
-    label own = owner[face];
-    label nei = neighbour[face];
+    const limitedSchemeGeometry::faceStencil& fs = stencil[face];
     pLim[face] = Limiter::limiter
     (
-      CDweights[face],
-      this->faceFlux_[face],
-      lPhi[own],
-      lPhi[nei],
-      gradc[own],
-      gradc[nei],
-      C[nei] - C[own]
+      fs.cdWeight,
+      faceFlux[face],
+      lPhi[fs.own],
+      lPhi[fs.nei],
+      gradc[fs.own],
+      gradc[fs.nei],
+      fs.d
     );
   }
   surfaceScalarField::GeometricBoundaryField& bLim =
@@ -68,8 +71,7 @@ void mousse::LimitedScheme<Type, Limiter, LimitFunc>::calcLimiter
       {
         gradc.boundaryField()[patchi].patchNeighbourField()
       };
-      // Build the d-vectors
-      vectorField pd{CDweights.boundaryField()[patchi].patch().delta()};
+      const vectorField& pd = geometry.patchDelta(patchi);
       FOR_ALL(pLim, face) {
         pLim[face] = Limiter::limiter
         (
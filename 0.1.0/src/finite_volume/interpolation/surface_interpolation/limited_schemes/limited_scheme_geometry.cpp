@@ -0,0 +1,66 @@
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+
+#include "limited_scheme_geometry.hpp"
+#include "vol_fields.hpp"
+#include "surface_fields.hpp"
+
+
+// Static Data Members
+namespace mousse {
+
+DEFINE_TYPE_NAME_AND_DEBUG(limitedSchemeGeometry, 0);
+
+}
+
+
+// Constructors
+mousse::limitedSchemeGeometry::limitedSchemeGeometry(const fvMesh& mesh)
+:
+  MeshObject<fvMesh, mousse::MoveableMeshObject, limitedSchemeGeometry>{mesh},
+  stencil_{mesh.nInternalFaces()},
+  patchDelta_{mesh.boundary().size()}
+{
+  calcStencil();
+}
+
+
+// Destructor
+mousse::limitedSchemeGeometry::~limitedSchemeGeometry()
+{}
+
+
+// Private Member Functions
+void mousse::limitedSchemeGeometry::calcStencil()
+{
+  if (debug) {
+    Info << "limitedSchemeGeometry::calcStencil() : "
+      << "Calculating limited scheme stencil"
+      << endl;
+  }
+  const surfaceScalarField& CDweights = mesh_.surfaceInterpolation::weights();
+  const labelUList& owner = mesh_.owner();
+  const labelUList& neighbour = mesh_.neighbour();
+  const vectorField& C = mesh_.C();
+  FOR_ALL(stencil_, facei) {
+    faceStencil& fs = stencil_[facei];
+    fs.own = owner[facei];
+    fs.nei = neighbour[facei];
+    fs.cdWeight = CDweights[facei];
+    fs.d = C[fs.nei] - C[fs.own];
+  }
+  const fvBoundaryMesh& patches = mesh_.boundary();
+  FOR_ALL(patches, patchi) {
+    if (patches[patchi].coupled()) {
+      patchDelta_.set(patchi, patches[patchi].delta().ptr());
+    }
+  }
+}
+
+
+// Member Functions
+bool mousse::limitedSchemeGeometry::movePoints()
+{
+  calcStencil();
+  return true;
+}
@@ -0,0 +1,81 @@
+#ifndef FINITE_VOLUME_INTERPOLATION_SURFACE_INTERPOLATION_LIMITED_SCHEMES_LIMITED_SCHEME_GEOMETRY_HPP_
+#define FINITE_VOLUME_INTERPOLATION_SURFACE_INTERPOLATION_LIMITED_SCHEMES_LIMITED_SCHEME_GEOMETRY_HPP_
+
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+// Class
+//   mousse::limitedSchemeGeometry
+// Description
+//   Per-mesh cache of the geometric stencil used by the NVD/TVD limited
+//   schemes.
+//   The owner/neighbour pair, central-differencing weight and cell-centre
+//   distance of every internal face are packed into a single contiguous
+//   list in face order so that the limiter loop streams through one array
+//   instead of gathering the cell centres and weights on every call.
+//   The d-vectors of the coupled patches are cached as well.
+
+#include "_mesh_object.hpp"
+#include "fv_mesh.hpp"
+#include "ptr_list.hpp"
+
+
+namespace mousse {
+
+class limitedSchemeGeometry
+:
+  public MeshObject<fvMesh, MoveableMeshObject, limitedSchemeGeometry>
+{
+public:
+  //- Stencil data of an internal face
+  struct faceStencil
+  {
+    label own;
+    label nei;
+    scalar cdWeight;
+    vector d;
+  };
+
+private:
+  // Private data
+    //- Packed stencil of the internal faces in face order
+    List<faceStencil> stencil_;
+    //- Cell-centre distance vectors of the coupled patches
+    PtrList<vectorField> patchDelta_;
+
+  // Private Member Functions
+    //- Calculate the stencil from the current mesh geometry
+    void calcStencil();
+
+public:
+  TYPE_NAME("limitedSchemeGeometry");
+
+  // Constructors
+    explicit limitedSchemeGeometry(const fvMesh& mesh);
+
+    //- Disallow default bitwise copy construct
+    limitedSchemeGeometry(const limitedSchemeGeometry&) = delete;
+
+    //- Disallow default bitwise assignment
+    limitedSchemeGeometry& operator=(const limitedSchemeGeometry&) = delete;
+
+  //- Destructor
+  virtual ~limitedSchemeGeometry();
+
+  // Member functions
+    //- Return the packed internal face stencil
+    const List<faceStencil>& stencil() const
+    {
+      return stencil_;
+    }
+    //- Return the d-vectors of coupled patch patchi
+    const vectorField& patchDelta(const label patchi) const
+    {
+      return patchDelta_[patchi];
+    }
+    //- Update the stencil when the mesh moves
+    virtual bool movePoints();
+};
+
+}  // namespace mousse
+
+#endif
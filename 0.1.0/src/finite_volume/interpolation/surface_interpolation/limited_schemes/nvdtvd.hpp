@@ -31,12 +31,9 @@ public:
     ) const
     {
       scalar gradf = phiN - phiP;
-      scalar gradcf;
-      if (faceFlux > 0) {
-        gradcf = d & gradcP;
-      } else {
-        gradcf = d & gradcN;
-      }
+      // Select the upwind gradient without branching on the flux
+      const vector& gradcU = faceFlux > 0 ? gradcP : gradcN;
+      scalar gradcf = d & gradcU;
       if (mag(gradf) >= 1000*mag(gradcf)) {
         return 1 - 0.5*1000*sign(gradcf)*sign(gradf);
       } else {
@@ -54,12 +51,8 @@ public:
     ) const
     {
       scalar gradf = phiN - phiP;
-      scalar gradcf;
-      if (faceFlux > 0) {
-        gradcf = d & gradcP;
-      } else {
-        gradcf = d & gradcN;
-      }
+      const vector& gradcU = faceFlux > 0 ? gradcP : gradcN;
+      scalar gradcf = d & gradcU;
       if (mag(gradcf) >= 1000*mag(gradf)) {
         return 2*1000*sign(gradcf)*sign(gradf) - 1;
       } else {
@@ -32,13 +32,9 @@ public:
     {
       vector gradfV = phiN - phiP;
       scalar gradf = gradfV & gradfV;
-      scalar gradcf;
-      if (faceFlux > 0) {
-        gradcf = gradfV & (d & gradcP);
-      } else
-      {
-        gradcf = gradfV & (d & gradcN);
-      }
+      // Select the upwind gradient without branching on the flux
+      const tensor& gradcU = faceFlux > 0 ? gradcP : gradcN;
+      scalar gradcf = gradfV & (d & gradcU);
       if (mag(gradf) >= 1000*mag(gradcf)) {
         return 1 - 0.5*1000*sign(gradcf)*sign(gradf);
       } else {
@@ -57,12 +53,8 @@ public:
     {
       vector gradfV = phiN - phiP;
       scalar gradf = gradfV & gradfV;
-      scalar gradcf;
-      if (faceFlux > 0) {
-        gradcf = gradfV & (d & gradcP);
-      } else {
-        gradcf = gradfV & (d & gradcN);
-      }
+      const tensor& gradcU = faceFlux > 0 ? gradcP : gradcN;
+      scalar gradcf = gradfV & (d & gradcU);
       if (mag(gradcf) >= 1000*mag(gradf)) {
         return 2*1000*sign(gradcf)*sign(gradf) - 1;
       } else {
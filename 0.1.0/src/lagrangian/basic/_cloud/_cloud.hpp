@@ -15,6 +15,7 @@
 #include "compact_io_field.hpp"
 #include "poly_mesh.hpp"
 #include "packed_bool_list.hpp"
+#include "pstream_buffers.hpp"
 
 
 namespace mousse {
@@ -45,6 +46,14 @@ class Cloud
     mutable label nTrackingRescues_;
     //- Does the cell have wall faces
     mutable autoPtr<PackedBoolList> cellWallFacesPtr_;
+    //- Particles removed from the mesh while it is redistributed
+    IDLList<ParticleType> heldParticles_;
+    //- Processor transfer buffers, kept between moves so that their
+    //  storage is reused
+    PstreamBuffers transferBuffers_;
+    //- Destination processorPatches indices for all of the neighbour
+    //  processors
+    List<DynamicList<label>> patchIndexTransferLists_;
   // Private Member Functions
     //- Check patches
     void checkPatches() const;
@@ -126,6 +135,11 @@ public:
       }
       //- Whether each cell has any wall faces (demand driven data)
       const PackedBoolList& cellHasWallFaces() const;
+      //- Add the number of particles in every cell to nCellParticles
+      virtual void countCellParticles(labelList& nCellParticles) const;
+      //- Fraction of consecutive particles in decreasing cell order.
+      //  Zero for a cell-sorted cloud, about a half for a random order.
+      scalar cellDisorder() const;
       //- Switch to specify if particles of the cloud can return
       //  non-zero wall distance values.  By default, assume
       //  that they can't (default for wallImpactDistance in
@@ -170,6 +184,9 @@ public:
       void deleteParticle(ParticleType&);
       //- Reset the particles
       void cloudReset(const Cloud<ParticleType>& c);
+      //- Reorder the particles by cell so that consecutive particles
+      //  use the same mesh data. Stable within a cell.
+      void sortByCell();
       //- Move the particles
       //  passing the TrackingData to the track function
       template<class TrackData>
@@ -178,6 +195,19 @@ public:
       //  mesh topology change
       template<class TrackData>
       void autoMap(TrackData& td, const mapPolyMesh&);
+      //- Can the cloud follow a redistribution of the mesh
+      virtual bool redistributable() const
+      {
+        return true;
+      }
+      //- Remove the particles from the mesh and hold them until the
+      //  mesh has been redistributed
+      virtual void prepareRedistribute();
+      //- Send the held particles to the processors their cells were
+      //  moved to and insert them into the redistributed mesh.
+      //  Particles keep their position and are relocated in the cell
+      //  given by the cell map of the distribution.
+      virtual void redistribute(const mapDistributePolyMesh&);
     // Read
       //- Helper to construct IOobject for field and current time.
       IOobject fieldIOobject
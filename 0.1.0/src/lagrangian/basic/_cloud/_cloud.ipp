@@ -7,8 +7,10 @@
 #include "global_mesh_data.hpp"
 #include "pstream_combine_reduce_ops.hpp"
 #include "map_poly_mesh.hpp"
+#include "map_distribute_poly_mesh.hpp"
 #include "time.hpp"
 #include "ofstream.hpp"
+#include "cpu_time.hpp"
 #include "wall_poly_patch.hpp"
 #include "cyclic_ami_poly_patch.hpp"
 
@@ -68,7 +70,10 @@ mousse::Cloud<ParticleType>::Cloud
   polyMesh_{pMesh},
   labels_{},
   nTrackingRescues_{},
-  cellWallFacesPtr_{}
+  cellWallFacesPtr_{},
+  heldParticles_{},
+  transferBuffers_{Pstream::nonBlocking},
+  patchIndexTransferLists_{}
 {
   checkPatches();
   // Ask for the tetBasePtIs to trigger all processors to build
@@ -92,7 +97,10 @@ mousse::Cloud<ParticleType>::Cloud
   polyMesh_{pMesh},
   labels_{},
   nTrackingRescues_{},
-  cellWallFacesPtr_{}
+  cellWallFacesPtr_{},
+  heldParticles_{},
+  transferBuffers_{Pstream::nonBlocking},
+  patchIndexTransferLists_{}
 {
   checkPatches();
   // Ask for the tetBasePtIs to trigger all processors to build
@@ -115,6 +123,36 @@ const
 }
 
 
+template<class ParticleType>
+void mousse::Cloud<ParticleType>::countCellParticles
+(
+  labelList& nCellParticles
+) const
+{
+  FOR_ALL_CONST_ITER(typename Cloud<ParticleType>, *this, pIter) {
+    nCellParticles[pIter().cell()]++;
+  }
+}
+
+
+template<class ParticleType>
+mousse::scalar mousse::Cloud<ParticleType>::cellDisorder() const
+{
+  if (size() < 2) {
+    return 0;
+  }
+  label nDecrease = 0;
+  label prevCell = -1;
+  FOR_ALL_CONST_ITER(typename Cloud<ParticleType>, *this, pIter) {
+    if (pIter().cell() < prevCell) {
+      nDecrease++;
+    }
+    prevCell = pIter().cell();
+  }
+  return scalar(nDecrease)/(size() - 1);
+}
+
+
 template<class ParticleType>
 void mousse::Cloud<ParticleType>::addParticle(ParticleType* pPtr)
 {
@@ -139,10 +177,37 @@ void mousse::Cloud<ParticleType>::cloudReset(const Cloud<ParticleType>& c)
 }
 
 
+template<class ParticleType>
+void mousse::Cloud<ParticleType>::sortByCell()
+{
+  // Counting sort on the cell label
+  labelList cellStart{polyMesh_.nCells() + 1, 0};
+  FOR_ALL_CONST_ITER(typename Cloud<ParticleType>, *this, pIter) {
+    cellStart[pIter().cell() + 1]++;
+  }
+  for (label celli = 1; celli < cellStart.size(); celli++) {
+    cellStart[celli] += cellStart[celli - 1];
+  }
+  List<ParticleType*> sorted{size()};
+  FOR_ALL_ITER(typename Cloud<ParticleType>, *this, pIter) {
+    sorted[cellStart[pIter().cell()]++] = &pIter();
+  }
+  // Relink the particles in sorted order without deleting them
+  this->DLListBase::clear();
+  FOR_ALL(sorted, i) {
+    this->append(sorted[i]);
+  }
+}
+
+
 template<class ParticleType>
 template<class TrackData>
 void mousse::Cloud<ParticleType>::move(TrackData& td, const scalar trackTime)
 {
+  // The time spent in the particle loop is accumulated for the particle
+  // weight of dynamicLoadBalanceFvMesh. Waiting for the neighbour
+  // processors is not counted.
+  const cpuTime trackingTimer;
   const polyBoundaryMesh& pbm = pMesh().boundaryMesh();
   const globalMeshData& pData = polyMesh_.globalData();
   // Which patches are processor patches
@@ -170,15 +235,18 @@ void mousse::Cloud<ParticleType>::move(TrackData& td, const scalar trackTime)
   List<IDLList<ParticleType>> particleTransferLists{neighbourProcs.size()};
   // List of destination processorPatches indices for all of the
   // neighbour processors
-  List<DynamicList<label>> patchIndexTransferLists{neighbourProcs.size()};
-  // Allocate transfer buffers
-  PstreamBuffers pBufs{Pstream::nonBlocking};
+  List<DynamicList<label>>& patchIndexTransferLists = patchIndexTransferLists_;
+  patchIndexTransferLists.setSize(neighbourProcs.size());
+  // Number of bytes received from every processor
+  labelList nRecvBytes;
   // While there are particles to transfer
   while (true) {
     particleTransferLists = IDLList<ParticleType>();
     FOR_ALL(patchIndexTransferLists, i) {
       patchIndexTransferLists[i].clear();
     }
+    label nTransfer = 0;
+    trackingTimer.cpuTimeIncrement();
     // Loop over all particles
     FOR_ALL_ITER(typename Cloud<ParticleType>, *this, pIter) {
       ParticleType& p = pIter();
@@ -207,47 +275,49 @@ void mousse::Cloud<ParticleType>::move(TrackData& td, const scalar trackTime)
             (
               procPatchNeighbours[patchI]
             );
+            nTransfer++;
           }
         }
       } else {
         deleteParticle(p);
       }
     }
+    addTrackingTime(trackingTimer.cpuTimeIncrement());
     if (!Pstream::parRun()) {
       break;
     }
+    // A single reduction is enough to find that no processor has
+    // anything to send, which is always the case in the last pass
+    if (!returnReduce(nTransfer > 0, orOp<bool>())) {
+      break;
+    }
     // Clear transfer buffers
-    pBufs.clear();
+    transferBuffers_.clear();
     // Stream into send buffers
     FOR_ALL(particleTransferLists, i) {
       if (particleTransferLists[i].size()) {
-        UOPstream particleStream{static_cast<int>(neighbourProcs[i]), pBufs};
+        UOPstream particleStream
+        {
+          static_cast<int>(neighbourProcs[i]),
+          transferBuffers_
+        };
         particleStream
           << patchIndexTransferLists[i]
           << particleTransferLists[i];
       }
     }
-    // Start sending. Sets number of bytes transferred
-    labelListList allNTrans{Pstream::nProcs()};
-    pBufs.finishedSends(allNTrans);
-    bool transfered = false;
-    FOR_ALL(allNTrans, i) {
-      FOR_ALL(allNTrans[i], j) {
-        if (allNTrans[i][j]) {
-          transfered = true;
-          break;
-        }
-      }
-    }
-    if (!transfered) {
-      break;
-    }
+    // Start sending. Particles only cross to processor patch neighbours
+    // so the sizes are exchanged with these only.
+    transferBuffers_.finishedNeighbourSends(neighbourProcs, nRecvBytes);
     // Retrieve from receive buffers
     FOR_ALL(neighbourProcs, i) {
       label neighbProci = neighbourProcs[i];
-      label nRec = allNTrans[neighbProci][Pstream::myProcNo()];
-      if (nRec) {
-        UIPstream particleStream{static_cast<int>(neighbProci), pBufs};
+      if (nRecvBytes[neighbProci]) {
+        UIPstream particleStream
+        {
+          static_cast<int>(neighbProci),
+          transferBuffers_
+        };
         labelList receivePatchIndex{particleStream};
         IDLList<ParticleType> newParticles
         {
@@ -323,6 +393,95 @@ void mousse::Cloud<ParticleType>::autoMap
 }
 
 
+template<class ParticleType>
+void mousse::Cloud<ParticleType>::prepareRedistribute()
+{
+  if (cloud::debug) {
+    Pout << "Cloud<ParticleType>::prepareRedistribute() : "
+      << "holding " << size() << " particles of cloud " << cloud::name()
+      << endl;
+  }
+  heldParticles_.transfer(*this);
+}
+
+
+template<class ParticleType>
+void mousse::Cloud<ParticleType>::redistribute
+(
+  const mapDistributePolyMesh& map
+)
+{
+  const labelListList& subMap = map.cellMap().subMap();
+  const labelListList& constructMap = map.cellMap().constructMap();
+  // Destination processor and position in the send list of every old cell
+  labelList cellProc{map.nOldCells(), -1};
+  labelList cellSlot{map.nOldCells(), -1};
+  FOR_ALL(subMap, procI) {
+    const labelList& cells = subMap[procI];
+    FOR_ALL(cells, i) {
+      cellProc[cells[i]] = procI;
+      cellSlot[cells[i]] = i;
+    }
+  }
+  // Reset stored data that relies on the mesh
+  cellWallFacesPtr_.clear();
+  polyMesh_.tetBasePtIs();
+  // Particles that stay are relocated directly, the others are sorted by
+  // destination processor together with their position in the send list
+  List<IDLList<ParticleType>> particleTransferLists{Pstream::nProcs()};
+  List<DynamicList<label>> slotTransferLists{Pstream::nProcs()};
+  FOR_ALL_ITER(typename Cloud<ParticleType>, heldParticles_, pIter) {
+    ParticleType& p = pIter();
+    const label procI = cellProc[p.cell()];
+    const label slot = cellSlot[p.cell()];
+    if (procI == Pstream::myProcNo()) {
+      p.cell() = constructMap[procI][slot];
+      p.face() = -1;
+      p.initCellFacePt();
+      addParticle(heldParticles_.remove(&p));
+    } else {
+      slotTransferLists[procI].append(slot);
+      particleTransferLists[procI].append(heldParticles_.remove(&p));
+    }
+  }
+  if (!Pstream::parRun()) {
+    return;
+  }
+  PstreamBuffers pBufs{Pstream::nonBlocking};
+  FOR_ALL(particleTransferLists, procI) {
+    if (particleTransferLists[procI].size()) {
+      UOPstream particleStream{static_cast<int>(procI), pBufs};
+      particleStream << slotTransferLists[procI];
+      FOR_ALL_CONST_ITER
+      (
+        typename Cloud<ParticleType>,
+        particleTransferLists[procI],
+        pIter
+      ) {
+        particleStream << pIter();
+      }
+    }
+  }
+  labelListList allNTrans{Pstream::nProcs()};
+  pBufs.finishedSends(allNTrans);
+  FOR_ALL(allNTrans, procI) {
+    if (allNTrans[procI][Pstream::myProcNo()]) {
+      UIPstream particleStream{static_cast<int>(procI), pBufs};
+      const labelList receiveSlot{particleStream};
+      // Construct directly rather than with iNew, which not all particle
+      // types provide
+      FOR_ALL(receiveSlot, i) {
+        ParticleType* newpPtr = new ParticleType(polyMesh_, particleStream);
+        newpPtr->cell() = constructMap[procI][receiveSlot[i]];
+        newpPtr->face() = -1;
+        newpPtr->initCellFacePt();
+        addParticle(newpPtr);
+      }
+    }
+  }
+}
+
+
 template<class ParticleType>
 void mousse::Cloud<ParticleType>::writePositions() const
 {
@@ -113,7 +113,10 @@ mousse::Cloud<ParticleType>::Cloud
   polyMesh_{pMesh},
   labels_{},
   nTrackingRescues_{},
-  cellWallFacesPtr_{}
+  cellWallFacesPtr_{},
+  heldParticles_{},
+  transferBuffers_{Pstream::nonBlocking},
+  patchIndexTransferLists_{}
 {
   checkPatches();
   initCloud(checkClass);
@@ -132,7 +135,10 @@ mousse::Cloud<ParticleType>::Cloud
   polyMesh_{pMesh},
   labels_{},
   nTrackingRescues_{},
-  cellWallFacesPtr_{}
+  cellWallFacesPtr_{},
+  heldParticles_{},
+  transferBuffers_{Pstream::nonBlocking},
+  patchIndexTransferLists_{}
 {
   checkPatches();
   initCloud(checkClass);
@@ -19,6 +19,7 @@
 #include "fixed_list.hpp"
 #include "poly_mesh_tet_decomposition.hpp"
 #include "particle_macros.hpp"
+#include "particle_storage.hpp"
 #include "poly_mesh.hpp"
 #include "time.hpp"
 
@@ -288,6 +289,17 @@ public:
   //- Destructor
   virtual ~particle()
   {}
+  // Memory management
+    //- Allocate from the pooled particle storage
+    static void* operator new(std::size_t size)
+    {
+      return particleStorage::New(size).allocate();
+    }
+    //- Return to the pooled particle storage
+    static void operator delete(void* ptr, std::size_t size)
+    {
+      particleStorage::New(size).deallocate(ptr);
+    }
   // Member Functions
     // Access
       //- Get unique particle creation id
@@ -0,0 +1,74 @@
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+
+#include "particle_storage.hpp"
+#include "debug.hpp"
+#include "register_switch.hpp"
+
+
+// Static Data Members
+int mousse::particleStorage::chunkSize
+(
+  mousse::debug::optimisationSwitch("particleChunkSize", 4096)
+);
+
+REGISTER_OPT_SWITCH
+(
+  "particleChunkSize",
+  int,
+  mousse::particleStorage::chunkSize
+);
+
+
+// Constructors 
+mousse::particleStorage::particleStorage(const std::size_t slotSize)
+:
+  slotSize_{max(slotSize, sizeof(void*))},
+  chunks_{},
+  freeSlot_{nullptr},
+  nUsed_{0},
+  nSlots_{0}
+{}
+
+
+// Selectors
+mousse::particleStorage& mousse::particleStorage::New(const std::size_t size)
+{
+  // Never destroyed: particles may be deleted during static destruction
+  static DynamicList<particleStorage*>* storagesPtr =
+    new DynamicList<particleStorage*>{};
+  DynamicList<particleStorage*>& storages = *storagesPtr;
+  FOR_ALL(storages, i) {
+    if (storages[i]->slotSize_ == max(size, sizeof(void*))) {
+      return *storages[i];
+    }
+  }
+  storages.append(new particleStorage{size});
+  return *storages.last();
+}
+
+
+// Destructor 
+mousse::particleStorage::~particleStorage()
+{
+  FOR_ALL(chunks_, i) {
+    ::operator delete(chunks_[i]);
+  }
+}
+
+
+// Private Member Functions 
+void mousse::particleStorage::addChunk()
+{
+  const label n = max(chunkSize, 1);
+  char* chunk = static_cast<char*>(::operator new(n*slotSize_));
+  chunks_.append(chunk);
+  // Thread the slots in address order so that consecutive allocations
+  // are adjacent
+  for (label i = n - 1; i >= 0; i--) {
+    void* slot = chunk + i*slotSize_;
+    *static_cast<void**>(slot) = freeSlot_;
+    freeSlot_ = slot;
+  }
+  nSlots_ += n;
+}
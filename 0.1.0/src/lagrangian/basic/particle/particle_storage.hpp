@@ -0,0 +1,112 @@
+#ifndef LAGRANGIAN_BASIC_PARTICLE_PARTICLE_STORAGE_HPP_
+#define LAGRANGIAN_BASIC_PARTICLE_PARTICLE_STORAGE_HPP_
+
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+// Class
+//   mousse::particleStorage
+// Description
+//   Pooled allocator for particles.
+//   Particles are allocated from chunks of equally sized slots instead of
+//   individually from the heap, with one storage per particle size, so
+//   creating or deleting a particle does not go through the system
+//   allocator. This is not a container: the particles are still held and
+//   iterated by their Cloud and have no stable index.
+//   Particles created before any deletion are adjacent in memory. Freed
+//   slots are reused last-in first-out, so after particles have been
+//   deleted new particles fill the scattered free slots first.
+//   Chunks are never returned to the system: the storages live until the
+//   end of the run, so the memory held is that of the peak number of
+//   particles.
+//   The number of slots per chunk is set by the particleChunkSize
+//   optimisation switch.
+
+#include "dynamic_list.hpp"
+
+
+namespace mousse {
+
+class particleStorage
+{
+  // Private data
+    //- Size of a slot in bytes
+    const std::size_t slotSize_;
+    //- Allocated chunks
+    DynamicList<char*> chunks_;
+    //- Head of the list of free slots
+    void* freeSlot_;
+    //- Number of slots in use
+    label nUsed_;
+    //- Total number of slots
+    label nSlots_;
+
+  // Private Member Functions
+    //- Allocate a chunk and add its slots to the free list
+    void addChunk();
+
+public:
+  // Static data
+    //- Number of slots per chunk
+    static int chunkSize;
+
+  // Constructors
+    //- Construct for slots of the given size
+    explicit particleStorage(const std::size_t slotSize);
+    //- Disallow default bitwise copy construct
+    particleStorage(const particleStorage&) = delete;
+    //- Disallow default bitwise assignment
+    particleStorage& operator=(const particleStorage&) = delete;
+
+  // Selectors
+    //- Return the storage for particles of the given size
+    static particleStorage& New(const std::size_t size);
+
+  //- Destructor
+  ~particleStorage();
+
+  // Member Functions
+    //- Size of a slot in bytes
+    std::size_t slotSize() const
+    {
+      return slotSize_;
+    }
+    //- Number of slots in use
+    label size() const
+    {
+      return nUsed_;
+    }
+    //- Total number of slots
+    label capacity() const
+    {
+      return nSlots_;
+    }
+    //- Return a free slot
+    inline void* allocate();
+    //- Return a slot to the free list
+    inline void deallocate(void* ptr);
+};
+
+}  // namespace mousse
+
+
+// Member Functions 
+inline void* mousse::particleStorage::allocate()
+{
+  if (!freeSlot_) {
+    addChunk();
+  }
+  void* ptr = freeSlot_;
+  freeSlot_ = *static_cast<void**>(freeSlot_);
+  nUsed_++;
+  return ptr;
+}
+
+
+inline void mousse::particleStorage::deallocate(void* ptr)
+{
+  *static_cast<void**>(ptr) = freeSlot_;
+  freeSlot_ = ptr;
+  nUsed_--;
+}
+
+#endif
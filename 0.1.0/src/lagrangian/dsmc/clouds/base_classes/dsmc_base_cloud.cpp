@@ -10,8 +10,19 @@ namespace mousse {
 
 DEFINE_TYPE_NAME_AND_DEBUG(DSMCBaseCloud, 0);
 
+template<>
+const char* NamedEnum<DSMCBaseCloud::partnerSelectionType, 3>::names[] =
+{
+  "uniform",
+  "subCell",
+  "nearestNeighbour"
+};
+
 }
 
+const mousse::NamedEnum<mousse::DSMCBaseCloud::partnerSelectionType, 3>
+  mousse::DSMCBaseCloud::partnerSelectionTypeNames;
+
 
 // Constructors 
 mousse::DSMCBaseCloud::DSMCBaseCloud()
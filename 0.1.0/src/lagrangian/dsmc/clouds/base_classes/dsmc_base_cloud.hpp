@@ -10,6 +10,7 @@
 //   Virtual abstract base class for templated DSMCCloud
 
 #include "vol_fields.hpp"
+#include "named_enum.hpp"
 
 
 namespace mousse {
@@ -17,6 +18,15 @@ namespace mousse {
 class DSMCBaseCloud
 {
 public:
+  //- Collision partner selection within a cell
+  enum partnerSelectionType
+  {
+    UNIFORM,            // any other parcel of the cell
+    SUBCELL,            // parcel of the same octant of the cell if possible
+    NEARESTNEIGHBOUR    // nearest parcel of the same octant if possible
+  };
+  //- Partner selection names
+  static const NamedEnum<partnerSelectionType, 3> partnerSelectionTypeNames;
   //- Runtime type information
   TYPE_NAME("DSMCBaseCloud");
   // Constructors
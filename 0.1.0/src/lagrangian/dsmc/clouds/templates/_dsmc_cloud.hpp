@@ -8,12 +8,21 @@
 //   mousse::DSMCCloud
 // Description
 //   Templated base class for dsmc cloud
+//   Collision partners are selected with the optional
+//   collisionPartnerSelection entry of the cloud properties: uniform
+//   (any parcel of the cell), subCell (default, the same octant of the
+//   cell if it holds another parcel) or nearestNeighbour (the nearest
+//   parcel of that octant), which reduces the mean collision separation
+//   on coarse meshes. The nearest neighbour selection excludes the last
+//   collision partner of the parcel in the time step so that the same
+//   pair does not collide repeatedly.
 
 #include "_cloud.hpp"
 #include "dsmc_base_cloud.hpp"
 #include "iodictionary.hpp"
 #include "auto_ptr.hpp"
 #include "random.hpp"
+#include "sub_list.hpp"
 #include "fv_mesh.hpp"
 #include "vol_fields.hpp"
 #include "scalar_io_field.hpp"
@@ -53,8 +62,16 @@ class DSMCCloud
     List<word> typeIdList_;
     //- Number of real atoms/molecules represented by a parcel
     scalar nParticle_;
-    //- A data structure holding which particles are in which cell
-    List<DynamicList<ParcelType*> > cellOccupancy_;
+    //- Collision partner selection within a cell
+    const partnerSelectionType partnerSelection_;
+    //- Start of the parcels of every subcell in cellParcels_. The eight
+    //  octants of a cell around its centre are consecutive subcells.
+    labelList subCellStart_;
+    //- Parcels ordered by cell and by subcell within the cell
+    List<ParcelType*> cellParcels_;
+    //- Position in cellParcels_ of the last collision partner of every
+    //  parcel in the time step, -1 if it has not collided
+    labelList lastPartner_;
     //- A field holding the value of (sigmaT * cR)max for each
     //  cell (see Bird p220). Initialised with the parcels,
     //  updated as required, and read in on start/restart.
@@ -101,8 +118,26 @@ class DSMCCloud
   // Private Member Functions
     //- Build the constant properties for all of the species
     void buildConstProps();
-    //- Record which particles are in which cell
+    //- Return the subcell of a parcel in its cell
+    inline label subCell(const ParcelType& p) const;
+    //- Record which particles are in which cell and subcell
     void buildCellOccupancy();
+    //- Nearest parcel to parcel candidateP among the n parcels from
+    //  start in cellParcels_, excluding its last collision partner.
+    //  Returns -1 if there is none.
+    label nearestPartner
+    (
+      const label candidateP,
+      const label start,
+      const label n
+    ) const;
+    //- Select the collision partner of parcel candidateP of a cell
+    label selectPartner
+    (
+      const label cellI,
+      const label candidateP,
+      const label subCellI
+    );
     //- Initialise the system
     void initialise(const IOdictionary& dsmcInitialiseDict);
     //- Calculate collisions between molecules
@@ -151,9 +186,11 @@ public:
         //- Return the number of real particles represented by one
         //  parcel
         inline scalar nParticle() const;
-        //- Return the cell occupancy addressing
-        inline const List<DynamicList<ParcelType*> >&
-          cellOccupancy() const;
+        //- Return the parcels of a cell
+        inline const SubList<ParcelType*> cellParcels
+        (
+          const label cellI
+        ) const;
         //- Return the sigmaTcRMax field.  non-const access to allow
         // updating.
         inline volScalarField& sigmaTcRMax();
@@ -313,6 +350,9 @@ public:
     // Mapping
       //- Remap the particles to the correct cells following mesh change
       virtual void autoMap(const mapPolyMesh&);
+      //- Insert the held parcels into the redistributed mesh and
+      //  rebuild the cell occupancy and the inflow patch data
+      virtual void redistribute(const mapDistributePolyMesh&);
 };
 
 }  // namespace mousse
@@ -357,10 +397,22 @@ inline mousse::scalar mousse::DSMCCloud<ParcelType>::nParticle() const
 
 
 template<class ParcelType>
-inline const mousse::List<mousse::DynamicList<ParcelType*> >&
-mousse::DSMCCloud<ParcelType>::cellOccupancy() const
+inline mousse::label mousse::DSMCCloud<ParcelType>::subCell
+(
+  const ParcelType& p
+) const
+{
+  const vector relPos = p.position() - mesh_.cellCentres()[p.cell()];
+  return pos(relPos.x()) + 2*pos(relPos.y()) + 4*pos(relPos.z());
+}
+
+
+template<class ParcelType>
+inline const mousse::SubList<ParcelType*>
+mousse::DSMCCloud<ParcelType>::cellParcels(const label cellI) const
 {
-  return cellOccupancy_;
+  const label start = subCellStart_[8*cellI];
+  return {cellParcels_, subCellStart_[8*cellI + 8] - start, start};
 }
 
 
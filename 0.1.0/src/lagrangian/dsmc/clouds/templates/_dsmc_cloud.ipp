@@ -37,12 +37,95 @@ void mousse::DSMCCloud<ParcelType>::buildConstProps()
 template<class ParcelType>
 void mousse::DSMCCloud<ParcelType>::buildCellOccupancy()
 {
-  FOR_ALL(cellOccupancy_, cO) {
-    cellOccupancy_[cO].clear();
+  // Counting sort of the parcels on cell and subcell
+  subCellStart_.setSize(8*mesh_.nCells() + 1);
+  subCellStart_ = 0;
+  labelList parcelSubCell{this->size()};
+  label parcelI = 0;
+  FOR_ALL_CONST_ITER(typename DSMCCloud<ParcelType>, *this, iter) {
+    const label subCellI = 8*iter().cell() + subCell(iter());
+    parcelSubCell[parcelI++] = subCellI;
+    subCellStart_[subCellI + 1]++;
+  }
+  for (label i = 1; i < subCellStart_.size(); i++) {
+    subCellStart_[i] += subCellStart_[i - 1];
   }
+  cellParcels_.setSize(this->size());
+  labelList fill{SubList<label>{subCellStart_, subCellStart_.size() - 1}};
+  parcelI = 0;
   FOR_ALL_ITER(typename DSMCCloud<ParcelType>, *this, iter) {
-    cellOccupancy_[iter().cell()].append(&iter());
+    cellParcels_[fill[parcelSubCell[parcelI++]]++] = &iter();
+  }
+  lastPartner_.setSize(this->size());
+  lastPartner_ = -1;
+}
+
+
+template<class ParcelType>
+mousse::label mousse::DSMCCloud<ParcelType>::nearestPartner
+(
+  const label candidateP,
+  const label start,
+  const label n
+) const
+{
+  const point& posP = cellParcels_[candidateP]->position();
+  label candidateQ = -1;
+  scalar minDistSqr = GREAT;
+  for (label i = start; i < start + n; i++) {
+    if (i != candidateP && i != lastPartner_[candidateP]) {
+      const scalar distSqr = magSqr(cellParcels_[i]->position() - posP);
+      if (distSqr < minDistSqr) {
+        minDistSqr = distSqr;
+        candidateQ = i;
+      }
+    }
   }
+  return candidateQ;
+}
+
+
+template<class ParcelType>
+mousse::label mousse::DSMCCloud<ParcelType>::selectPartner
+(
+  const label cellI,
+  const label candidateP,
+  const label subCellI
+)
+{
+  label start = subCellStart_[8*cellI];
+  label n = subCellStart_[8*cellI + 8] - start;
+  if (partnerSelection_ != UNIFORM) {
+    // Select from the subcell of the first candidate if it has another
+    // parcel, otherwise from the whole cell
+    const label nSC =
+      subCellStart_[8*cellI + subCellI + 1] - subCellStart_[8*cellI + subCellI];
+    if (nSC > 1) {
+      start = subCellStart_[8*cellI + subCellI];
+      n = nSC;
+    }
+  }
+  if (partnerSelection_ == NEARESTNEIGHBOUR) {
+    label candidateQ = nearestPartner(candidateP, start, n);
+    // If the last partner is the only other parcel of the subcell search
+    // the whole cell, and collide with it again only if it is alone there
+    if (candidateQ == -1) {
+      candidateQ =
+        nearestPartner
+        (
+          candidateP,
+          subCellStart_[8*cellI],
+          subCellStart_[8*cellI + 8] - subCellStart_[8*cellI]
+        );
+    }
+    return candidateQ == -1 ? lastPartner_[candidateP] : candidateQ;
+  }
+  // If the same candidate is chosen, choose again
+  label candidateQ = -1;
+  do {
+    candidateQ = start + rndGen_.integer(0, n - 1);
+  } while (candidateP == candidateQ);
+  return candidateQ;
 }
 
 
@@ -137,32 +220,13 @@ void mousse::DSMCCloud<ParcelType>::collisions()
   if (!binaryCollision().active()) {
     return;
   }
-  // Temporary storage for subCells
-  List<DynamicList<label>> subCells{8};
   scalar deltaT = mesh().time().deltaTValue();
   label collisionCandidates = 0;
   label collisions = 0;
-  FOR_ALL(cellOccupancy_, cellI) {
-    const DynamicList<ParcelType*>& cellParcels{cellOccupancy_[cellI]};
-    label nC{cellParcels.size()};
+  FOR_ALL(mesh_.cells(), cellI) {
+    const label cellStart = subCellStart_[8*cellI];
+    const label nC = subCellStart_[8*cellI + 8] - cellStart;
     if (nC > 1) {
-      // Assign particles to one of 8 Cartesian subCells
-      // Clear temporary lists
-      FOR_ALL(subCells, i) {
-        subCells[i].clear();
-      }
-      // Inverse addressing specifying which subCell a parcel is in
-      List<label> whichSubCell{cellParcels.size()};
-      const point& cC = mesh_.cellCentres()[cellI];
-      FOR_ALL(cellParcels, i) {
-        const ParcelType& p = *cellParcels[i];
-        vector relPos = p.position() - cC;
-        label subCell =
-          pos(relPos.x()) + 2*pos(relPos.y()) + 4*pos(relPos.z());
-        subCells[subCell].append(i);
-        whichSubCell[i] = subCell;
-      }
-      // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
       scalar sigmaTcRMax = sigmaTcRMax_[cellI];
       const scalar Vi = mesh_.cellVolumes()[cellI];
       scalar selectedPairs =
@@ -172,43 +236,16 @@ void mousse::DSMCCloud<ParcelType>::collisions()
       collisionSelectionRemainder_[cellI] = selectedPairs - nCandidates;
       collisionCandidates += nCandidates;
       for (label c = 0; c < nCandidates; c++) {
-        // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-        // subCell candidate selection procedure
         // Select the first collision candidate
-        label candidateP = rndGen_.integer(0, nC - 1);
-        // Declare the second collision candidate
-        label candidateQ = -1;
-        List<label> subCellPs = subCells[whichSubCell[candidateP]];
-        label nSC = subCellPs.size();
-        if (nSC > 1) {
-          // If there are two or more particle in a subCell, choose
-          // another from the same cell.  If the same candidate is
-          // chosen, choose again.
-          do {
-            candidateQ = subCellPs[rndGen_.integer(0, nSC - 1)];
-          } while (candidateP == candidateQ);
-        } else {
-          // Select a possible second collision candidate from the
-          // whole cell.  If the same candidate is chosen, choose
-          // again.
-          do {
-            candidateQ = rndGen_.integer(0, nC - 1);
-          } while (candidateP == candidateQ);
+        const label candidateP = cellStart + rndGen_.integer(0, nC - 1);
+        // Find its subcell from the ordering of the parcels
+        label subCellI = 0;
+        while (subCellStart_[8*cellI + subCellI + 1] <= candidateP) {
+          subCellI++;
         }
-        // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-        // uniform candidate selection procedure
-        // // Select the first collision candidate
-        // label candidateP = rndGen_.integer(0, nC-1);
-        // // Select a possible second collision candidate
-        // label candidateQ = rndGen_.integer(0, nC-1);
-        // // If the same candidate is chosen, choose again
-        // while (candidateP == candidateQ)
-        // {
-        //     candidateQ = rndGen_.integer(0, nC-1);
-        // }
-        // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-        ParcelType& parcelP = *cellParcels[candidateP];
-        ParcelType& parcelQ = *cellParcels[candidateQ];
+        const label candidateQ = selectPartner(cellI, candidateP, subCellI);
+        ParcelType& parcelP = *cellParcels_[candidateP];
+        ParcelType& parcelQ = *cellParcels_[candidateQ];
         scalar sigmaTcR =
           binaryCollision().sigmaTcR(parcelP, parcelQ);
         // Update the maximum value of sigmaTcR stored, but use the
@@ -219,6 +256,8 @@ void mousse::DSMCCloud<ParcelType>::collisions()
         }
         if ((sigmaTcR/sigmaTcRMax) > rndGen_.scalar01()) {
           binaryCollision().collide(parcelP, parcelQ);
+          lastPartner_[candidateP] = candidateQ;
+          lastPartner_[candidateQ] = candidateP;
           collisions++;
         }
       }
@@ -347,7 +386,18 @@ mousse::DSMCCloud<ParcelType>::DSMCCloud
   },
   typeIdList_{particleProperties_.lookup("typeIdList")},
   nParticle_{readScalar(particleProperties_.lookup("nEquivalentParticles"))},
-  cellOccupancy_{mesh_.nCells()},
+  partnerSelection_
+  {
+    particleProperties_.found("collisionPartnerSelection")
+   ? partnerSelectionTypeNames.read
+    (
+      particleProperties_.lookup("collisionPartnerSelection")
+    )
+   : SUBCELL
+  },
+  subCellStart_{8*mesh_.nCells() + 1, 0},
+  cellParcels_{},
+  lastPartner_{},
   sigmaTcRMax_
   {
     IOobject
@@ -568,7 +618,10 @@ mousse::DSMCCloud<ParcelType>::DSMCCloud
   },
   typeIdList_{particleProperties_.lookup("typeIdList")},
   nParticle_{readScalar(particleProperties_.lookup("nEquivalentParticles"))},
-  cellOccupancy_{},
+  partnerSelection_{SUBCELL},
+  subCellStart_{8*mesh_.nCells() + 1, 0},
+  cellParcels_{},
+  lastPartner_{},
   sigmaTcRMax_
   {
     IOobject
@@ -878,10 +931,23 @@ void mousse::DSMCCloud<ParcelType>::autoMap(const mapPolyMesh& mapper)
   typedef typename  ParcelType::trackingData tdType;
   tdType td{*this};
   Cloud<ParcelType>::template autoMap<tdType>(td, mapper);
-  // Update the cell occupancy field
-  cellOccupancy_.setSize(mesh_.nCells());
+  // Update the cell occupancy addressing
   buildCellOccupancy();
   // Update the inflow BCs
   this->inflowBoundary().autoMap(mapper);
 }
 
+
+template<class ParcelType>
+void mousse::DSMCCloud<ParcelType>::redistribute
+(
+  const mapDistributePolyMesh& map
+)
+{
+  Cloud<ParcelType>::redistribute(map);
+  // Update the cell occupancy addressing
+  buildCellOccupancy();
+  // Update the inflow BCs
+  this->inflowBoundary().redistribute(map);
+}
+
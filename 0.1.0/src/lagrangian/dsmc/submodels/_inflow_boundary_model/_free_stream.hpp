@@ -37,6 +37,9 @@ class FreeStream
     // + Each field entry corresponding to a face to be injected across
     //   with a particular species
     List<List<Field<scalar>>> particleFluxAccumulators_;
+  // Private Member Functions
+    //- Resize the particleFluxAccumulators_ to the patch sizes
+    void resizeAccumulators();
 public:
   //- Runtime type information
   TYPE_NAME("FreeStream");
@@ -53,6 +56,8 @@ public:
     // Mapping
       //- Remap the particles to the correct cells following mesh change
       virtual void autoMap(const mapPolyMesh&);
+      //- Resize the patch data following redistribution of the mesh
+      virtual void redistribute(const mapDistributePolyMesh&);
     //- Introduce particles
     virtual void inflow();
 };
@@ -11,6 +11,21 @@
 using namespace mousse::constant::mathematical;
 
 
+// Private Member Functions
+template<class CloudType>
+void mousse::FreeStream<CloudType>::resizeAccumulators()
+{
+  const polyMesh& mesh = this->owner().mesh();
+  FOR_ALL(patches_, p) {
+    const polyPatch& patch = mesh.boundaryMesh()[patches_[p]];
+    List<Field<scalar>>& pFA = particleFluxAccumulators_[p];
+    FOR_ALL(pFA, i) {
+      pFA[i].setSize(patch.size(), 0);
+    }
+  }
+}
+
+
 // Constructors
 template<class CloudType>
 mousse::FreeStream<CloudType>::FreeStream
@@ -81,16 +96,14 @@ mousse::FreeStream<CloudType>::~FreeStream()
 template<class CloudType>
 void mousse::FreeStream<CloudType>::autoMap(const mapPolyMesh&)
 {
-  CloudType& cloud = this->owner();
-  const polyMesh& mesh = cloud.mesh();
-  FOR_ALL(patches_, p) {
-    label patchi = patches_[p];
-    const polyPatch& patch = mesh.boundaryMesh()[patchi];
-    List<Field<scalar> >& pFA = particleFluxAccumulators_[p];
-    FOR_ALL(pFA, facei) {
-      pFA[facei].setSize(patch.size(), 0);
-    }
-  }
+  resizeAccumulators();
+}
+
+
+template<class CloudType>
+void mousse::FreeStream<CloudType>::redistribute(const mapDistributePolyMesh&)
+{
+  resizeAccumulators();
 }
 
 
@@ -16,6 +16,9 @@
 
 namespace mousse {
 
+// Forward declaration of classes
+class mapDistributePolyMesh;
+
 template<class CloudType>
 class InflowBoundaryModel
 {
@@ -72,6 +75,9 @@ public:
     //- Remap the particles to the correct cells following mesh change
     virtual void autoMap(const mapPolyMesh&)
     {}
+    //- Update the patch data following redistribution of the mesh
+    virtual void redistribute(const mapDistributePolyMesh&)
+    {}
   //- Introduce particles
   virtual void inflow() = 0;
 };
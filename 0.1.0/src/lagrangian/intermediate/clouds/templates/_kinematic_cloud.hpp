@@ -91,6 +91,8 @@ protected:
     autoPtr<List<DynamicList<parcelType*>>> cellOccupancyPtr_;
     //- Cell length scale
     scalarField cellLengthScale_;
+    //- Parcels tracked per CPU second during the last evolution
+    scalar trackingRate_;
     // References to the carrier gas fields
       //- Density [kg/m3]
       const volScalarField& rho_;
@@ -397,6 +399,8 @@ public:
       //- Remap the cells of particles corresponding to the
       //  mesh topology change with a default tracking data object
       virtual void autoMap(const mapPolyMesh&);
+      //- Insert the held parcels into the redistributed mesh
+      virtual void redistribute(const mapDistributePolyMesh&);
     // I-O
       //- Print cloud information
       void info();
@@ -6,6 +6,7 @@
 #include "_integration_scheme.hpp"
 #include "interpolation.hpp"
 #include "sub_cycle_time.hpp"
+#include "cpu_time.hpp"
 
 #include "_injection_model_list.hpp"
 #include "_dispersion_model.hpp"
@@ -138,9 +139,27 @@ void mousse::KinematicCloud<CloudType>::evolveCloud(TrackData& td)
       preInjectionSize = this->size();
     }
     injectors_.inject(td);
+    // Tracking parcels in cell order reuses the cell, face and point data
+    // of the previous parcel. Injection and migration append parcels out
+    // of order so re-sort once the disorder exceeds the tolerance.
+    if (solution_.sortParcels()) {
+      const scalar disorder = this->cellDisorder();
+      if (disorder > solution_.sortTolerance()) {
+        this->sortByCell();
+        updateCellOccupancy();
+        if (debug) {
+          Pout << "Sorted parcels of cloud " << this->name()
+            << " by cell, disorder " << disorder << endl;
+        }
+      }
+    }
     // Assume that motion will update the cellOccupancy as necessary
     // before it is required.
+    const label nTracked = this->size();
+    const cpuTime motionTimer;
     td.cloud().motion(td);
+    const scalar motionTime = motionTimer.cpuTimeIncrement();
+    trackingRate_ = motionTime > VSMALL ? nTracked/motionTime : 0;
     stochasticCollision().update(solution_.trackTime());
   } else {
 //        this->surfaceFilm().injectSteadyState(td);
@@ -241,6 +260,7 @@ mousse::KinematicCloud<CloudType>::KinematicCloud
   },
   cellOccupancyPtr_{},
   cellLengthScale_{cbrt(mesh_.V())},
+  trackingRate_{0},
   rho_{rho},
   U_{U},
   mu_{mu},
@@ -335,6 +355,7 @@ mousse::KinematicCloud<CloudType>::KinematicCloud
   rndGen_{c.rndGen_, true},
   cellOccupancyPtr_{NULL},
   cellLengthScale_{c.cellLengthScale_},
+  trackingRate_{c.trackingRate_},
   rho_{c.rho_},
   U_{c.U_},
   mu_{c.mu_},
@@ -422,6 +443,7 @@ mousse::KinematicCloud<CloudType>::KinematicCloud
   rndGen_{0, 0},
   cellOccupancyPtr_{nullptr},
   cellLengthScale_{c.cellLengthScale_},
+  trackingRate_{c.trackingRate_},
   rho_{c.rho_},
   U_{c.U_},
   mu_{c.mu_},
@@ -718,6 +740,17 @@ void mousse::KinematicCloud<CloudType>::autoMap(const mapPolyMesh& mapper)
 }
 
 
+template<class CloudType>
+void mousse::KinematicCloud<CloudType>::redistribute
+(
+  const mapDistributePolyMesh& map
+)
+{
+  Cloud<parcelType>::redistribute(map);
+  updateMesh();
+}
+
+
 template<class CloudType>
 void mousse::KinematicCloud<CloudType>::info()
 {
@@ -736,6 +769,10 @@ void mousse::KinematicCloud<CloudType>::info()
     << mag(linearMomentum) << nl
     << "    Linear kinetic energy           = "
     << linearKineticEnergy << nl;
+  if (returnReduce(this->size(), sumOp<label>()) > 0) {
+    Info << "    Parcel tracking rate            = "
+      << returnReduce(trackingRate_, sumOp<scalar>()) << " parcels/s" << nl;
+  }
   injectors_.info(Info);
   this->surfaceFilm().info(Info);
   this->patchInteraction().info(Info);
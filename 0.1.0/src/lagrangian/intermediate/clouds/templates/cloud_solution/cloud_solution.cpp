@@ -25,7 +25,9 @@ mousse::cloudSolution::cloudSolution
   cellValueSourceCorrection_{false},
   maxTrackTime_{0.0},
   resetSourcesOnStartup_{true},
-  schemes_{}
+  schemes_{},
+  sortParcels_{false},
+  sortTolerance_{0.1}
 {
   if (active_) {
     read();
@@ -50,7 +52,9 @@ mousse::cloudSolution::cloudSolution
   cellValueSourceCorrection_{cs.cellValueSourceCorrection_},
   maxTrackTime_{cs.maxTrackTime_},
   resetSourcesOnStartup_{cs.resetSourcesOnStartup_},
-  schemes_{cs.schemes_}
+  schemes_{cs.schemes_},
+  sortParcels_{cs.sortParcels_},
+  sortTolerance_{cs.sortTolerance_}
 {}
 
 
@@ -71,7 +75,9 @@ mousse::cloudSolution::cloudSolution
   cellValueSourceCorrection_{false},
   maxTrackTime_{0.0},
   resetSourcesOnStartup_{false},
-  schemes_{}
+  schemes_{},
+  sortParcels_{false},
+  sortTolerance_{0.1}
 {}
 
 
@@ -87,6 +93,8 @@ void mousse::cloudSolution::read()
   dict_.lookup("coupled") >> coupled_;
   dict_.lookup("cellValueSourceCorrection") >> cellValueSourceCorrection_;
   dict_.readIfPresent("maxCo", maxCo_);
+  dict_.readIfPresent("sortParcels", sortParcels_);
+  dict_.readIfPresent("sortTolerance", sortTolerance_);
   if (steadyState()) {
     dict_.lookup("calcFrequency") >> calcFrequency_;
     dict_.lookup("maxTrackTime") >> maxTrackTime_;
@@ -53,6 +53,10 @@ class cloudSolution
       Switch resetSourcesOnStartup_;
       //- List schemes, e.g. U semiImplicit 1
       List<Tuple2<word, Tuple2<bool, scalar>>> schemes_;
+      //- Flag to reorder the parcels by cell before tracking
+      Switch sortParcels_;
+      //- Fraction of parcels out of cell order above which to re-sort
+      scalar sortTolerance_;
 public:
   // Constructors
     //- Construct null from mesh reference
@@ -103,6 +107,10 @@ public:
       inline scalar maxTrackTime() const;
       //- Return const access to the reset sources flag
       inline const Switch resetSourcesOnStartup() const;
+      //- Return const access to the parcel sorting flag
+      inline const Switch sortParcels() const;
+      //- Return the parcel disorder above which to re-sort
+      inline scalar sortTolerance() const;
       //- Source terms dictionary
       inline const dictionary& sourceTermDict() const;
       //- Interpolation schemes dictionary
@@ -229,4 +237,16 @@ inline const mousse::Switch mousse::cloudSolution::resetSourcesOnStartup() const
   return resetSourcesOnStartup_;
 }
 
+
+inline const mousse::Switch mousse::cloudSolution::sortParcels() const
+{
+  return sortParcels_;
+}
+
+
+inline mousse::scalar mousse::cloudSolution::sortTolerance() const
+{
+  return sortTolerance_;
+}
+
 #endif
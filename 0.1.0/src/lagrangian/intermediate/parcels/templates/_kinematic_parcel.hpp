@@ -109,6 +109,9 @@ public:
         autoPtr<interpolation<vector>> UInterp_;
         //- Dynamic viscosity interpolator
         autoPtr<interpolation<scalar>> muInterp_;
+      //- Interpolation weights of the parcel position for the current
+      //  sub-step, shared by the interpolators of all carrier fields
+      tetPointWeight tetWeights_;
       //- Local gravitational or other body-force acceleration
       const vector& g_;
       // label specifying which part of the integration
@@ -132,6 +135,12 @@ public:
       //- Return conat access to the interpolator for continuous
       //  phase dynamic viscosity field
       inline const interpolation<scalar>& muInterp() const;
+      //- Return const access to the interpolation weights of the
+      //  parcel position for the current sub-step
+      inline const tetPointWeight& tetWeights() const;
+      //- Return access to the interpolation weights of the parcel
+      //  position for the current sub-step
+      inline tetPointWeight& tetWeights();
       // Return const access to the gravitational acceleration vector
       inline const vector& g() const;
       //- Return the part of the tracking operation taking place
@@ -913,6 +922,7 @@ inline mousse::KinematicParcel<ParcelType>::TrackingData<CloudType>::TrackingDat
       cloud.mu()
     )
   },
+  tetWeights_{},
   g_{cloud.g().value()},
   part_{part}
 {}
@@ -945,6 +955,24 @@ mousse::KinematicParcel<ParcelType>::TrackingData<CloudType>::muInterp() const
 }
 
 
+template<class ParcelType>
+template<class CloudType>
+inline const mousse::tetPointWeight&
+mousse::KinematicParcel<ParcelType>::TrackingData<CloudType>::tetWeights() const
+{
+  return tetWeights_;
+}
+
+
+template<class ParcelType>
+template<class CloudType>
+inline mousse::tetPointWeight&
+mousse::KinematicParcel<ParcelType>::TrackingData<CloudType>::tetWeights()
+{
+  return tetWeights_;
+}
+
+
 template<class ParcelType>
 template<class CloudType>
 inline const mousse::vector&
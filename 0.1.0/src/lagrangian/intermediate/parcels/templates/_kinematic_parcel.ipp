@@ -23,8 +23,14 @@ void mousse::KinematicParcel<ParcelType>::setCellValues
   const label cellI
 )
 {
-  tetIndices tetIs = this->currentTetIndices();
-  rhoc_ = td.rhoInterp().interpolate(this->position(), tetIs);
+  // Locate the parcel in its tetrahedron once for all carrier fields
+  td.tetWeights().set
+  (
+    td.cloud().pMesh(),
+    this->position(),
+    this->currentTetIndices()
+  );
+  rhoc_ = td.rhoInterp().interpolate(td.tetWeights());
   if (rhoc_ < td.cloud().constProps().rhoMin()) {
     if (debug) {
       WARNING_IN
@@ -41,8 +47,8 @@ void mousse::KinematicParcel<ParcelType>::setCellValues
     }
     rhoc_ = td.cloud().constProps().rhoMin();
   }
-  Uc_ = td.UInterp().interpolate(this->position(), tetIs);
-  muc_ = td.muInterp().interpolate(this->position(), tetIs);
+  Uc_ = td.UInterp().interpolate(td.tetWeights());
+  muc_ = td.muInterp().interpolate(td.tetWeights());
   // Apply dispersion components to carrier phase velocity
   Uc_ =
     td.cloud().dispersion().update
@@ -54,23 +54,34 @@ public:
     };
   private:
     // Private data
-      // MPPIC Averages
+      // MPPIC Averages, held by the mesh registry between time steps
         //- Volume average
-        autoPtr<AveragingMethod<scalar>> volumeAverage_;
+        AveragingMethod<scalar>& volumeAverage_;
         //- Radius average [ volume^(1/3) ]
-        autoPtr<AveragingMethod<scalar>> radiusAverage_;
+        AveragingMethod<scalar>& radiusAverage_;
         //- Density average
-        autoPtr<AveragingMethod<scalar>> rhoAverage_;
+        AveragingMethod<scalar>& rhoAverage_;
         //- Velocity average
-        autoPtr<AveragingMethod<vector>> uAverage_;
+        AveragingMethod<vector>& uAverage_;
         //- Magnitude velocity sqyuared average
-        autoPtr<AveragingMethod<scalar>> uSqrAverage_;
+        AveragingMethod<scalar>& uSqrAverage_;
         //- Frequency average
-        autoPtr<AveragingMethod<scalar>> frequencyAverage_;
+        AveragingMethod<scalar>& frequencyAverage_;
         //- Mass average
-        autoPtr<AveragingMethod<scalar>> massAverage_;
+        AveragingMethod<scalar>& massAverage_;
+        //- Weights of the radius and frequency averages
+        AveragingMethod<scalar>& weightAverage_;
       //- Label specifying the current part of the tracking process
       trackPart part_;
+    // Private Member Functions
+      //- Return the named average of the cloud from the mesh registry,
+      //  constructing it on first use or when the mesh has changed
+      template<class Type>
+      static AveragingMethod<Type>& average
+      (
+        CloudType& cloud,
+        const word& name
+      );
   public:
     //- Constructors
       //- Construct from components
@@ -265,111 +276,62 @@ inline mousse::vector& mousse::MPPICParcel<ParcelType>::UCorrect()
 
 template<class ParcelType>
 template<class CloudType>
-inline mousse::MPPICParcel<ParcelType>::TrackingData<CloudType>::TrackingData
+template<class Type>
+mousse::AveragingMethod<Type>&
+mousse::MPPICParcel<ParcelType>::TrackingData<CloudType>::average
 (
   CloudType& cloud,
-  trackPart part
+  const word& name
 )
-:
-  ParcelType::template TrackingData<CloudType>{cloud},
-  volumeAverage_
-  {
-    AveragingMethod<scalar>::New
-    (
-      // IOobject
-      {
-        cloud.name() + ":volumeAverage",
-        cloud.db().time().timeName(),
-        cloud.mesh()
-      },
-      cloud.solution().dict(),
-      cloud.mesh()
-    )
-  },
-  radiusAverage_
-  {
-    AveragingMethod<scalar>::New
-    (
-      // IOobject
-      {
-        cloud.name() + ":radiusAverage",
-        cloud.db().time().timeName(),
-        cloud.mesh()
-      },
-      cloud.solution().dict(),
-      cloud.mesh()
-    )
-  },
-  rhoAverage_
-  {
-    AveragingMethod<scalar>::New
-    (
-      // IOobject
-      {
-        cloud.name() + ":rhoAverage",
-        cloud.db().time().timeName(),
-        cloud.mesh()
-      },
-      cloud.solution().dict(),
-      cloud.mesh()
-    )
-  },
-  uAverage_
-  {
-    AveragingMethod<vector>::New
-    (
-      // IOobject
-      {
-        cloud.name() + ":uAverage",
-        cloud.db().time().timeName(),
-        cloud.mesh()
-      },
-      cloud.solution().dict(),
-      cloud.mesh()
-    )
-  },
-  uSqrAverage_
-  {
-    AveragingMethod<scalar>::New
-    (
-      // IOobject
-      {
-        cloud.name() + ":uSqrAverage",
-        cloud.db().time().timeName(),
-        cloud.mesh()
-      },
-      cloud.solution().dict(),
-      cloud.mesh()
-    )
-  },
-  frequencyAverage_
-  {
-    AveragingMethod<scalar>::New
-    (
-      // IOobject
-      {
-        cloud.name() + ":frequencyAverage",
-        cloud.db().time().timeName(),
-        cloud.mesh()
-      },
-      cloud.solution().dict(),
-      cloud.mesh()
-    )
-  },
-  massAverage_
-  {
-    AveragingMethod<scalar>::New
+{
+  const fvMesh& mesh = cloud.mesh();
+  const word fieldName{cloud.name() + ":" + name};
+  if (mesh.foundObject<AveragingMethod<Type>>(fieldName)) {
+    AveragingMethod<Type>& am =
+      const_cast<AveragingMethod<Type>&>
+      (
+        mesh.lookupObject<AveragingMethod<Type>>(fieldName)
+      );
+    // The averages hold the cell and point volumes of the mesh
+    if (!mesh.changing() && am[0].size() == mesh.nCells()) {
+      return am;
+    }
+    am.checkOut();
+  }
+  AveragingMethod<Type>* amPtr =
+    AveragingMethod<Type>::New
     (
       // IOobject
       {
-        cloud.name() + ":massAverage",
+        fieldName,
         cloud.db().time().timeName(),
-        cloud.mesh()
+        mesh
       },
       cloud.solution().dict(),
-      cloud.mesh()
-    )
-  },
+      mesh
+    ).ptr();
+  amPtr->store();
+  return *amPtr;
+}
+
+
+template<class ParcelType>
+template<class CloudType>
+inline mousse::MPPICParcel<ParcelType>::TrackingData<CloudType>::TrackingData
+(
+  CloudType& cloud,
+  trackPart part
+)
+:
+  ParcelType::template TrackingData<CloudType>{cloud},
+  volumeAverage_{average<scalar>(cloud, "volumeAverage")},
+  radiusAverage_{average<scalar>(cloud, "radiusAverage")},
+  rhoAverage_{average<scalar>(cloud, "rhoAverage")},
+  uAverage_{average<vector>(cloud, "uAverage")},
+  uSqrAverage_{average<scalar>(cloud, "uSqrAverage")},
+  frequencyAverage_{average<scalar>(cloud, "frequencyAverage")},
+  massAverage_{average<scalar>(cloud, "massAverage")},
+  weightAverage_{average<scalar>(cloud, "weightAverage")},
   part_(part)
 {}
 
@@ -383,83 +345,58 @@ mousse::MPPICParcel<ParcelType>::TrackingData<CloudType>::updateAverages
 )
 {
   // zero the sums
-  volumeAverage_() = 0;
-  radiusAverage_() = 0;
-  rhoAverage_() = 0;
-  uAverage_() = vector::zero;
-  uSqrAverage_() = 0;
-  frequencyAverage_() = 0;
-  massAverage_() = 0;
-  // temporary weights
-  autoPtr<AveragingMethod<scalar>> weightAveragePtr
-  {
-    AveragingMethod<scalar>::New
-    (
-      {
-        cloud.name() + ":weightAverage",
-        cloud.db().time().timeName(),
-        cloud.mesh()
-      },
-      cloud.solution().dict(),
-      cloud.mesh()
-    )
-  };
-  AveragingMethod<scalar>& weightAverage = weightAveragePtr();
-  // averaging sums
+  volumeAverage_ = 0;
+  radiusAverage_ = 0;
+  rhoAverage_ = 0;
+  uAverage_ = vector::zero;
+  uSqrAverage_ = 0;
+  frequencyAverage_ = 0;
+  massAverage_ = 0;
+  weightAverage_ = 0;
+  // locate every parcel in its tetrahedron once for all the averages
+  List<tetPointWeight> parcelWeights{cloud.size()};
+  label parcelI = 0;
+  // averaging sums of the moments which do not depend on other averages
   FOR_ALL_CONST_ITER(typename CloudType, cloud, iter) {
     const typename CloudType::parcelType& p = iter();
-    const tetIndices tetIs(p.cell(), p.tetFace(), p.tetPt(), cloud.mesh());
-    const scalar m = p.nParticle()*p.mass();
-    volumeAverage_->add(p.position(), tetIs, p.nParticle()*p.volume());
-    rhoAverage_->add(p.position(), tetIs, m*p.rho());
-    uAverage_->add(p.position(), tetIs, m*p.U());
-    massAverage_->add(p.position(), tetIs, m);
-  }
-  volumeAverage_->average();
-  massAverage_->average();
-  rhoAverage_->average(massAverage_);
-  uAverage_->average(massAverage_);
-  // squared velocity deviation
-  FOR_ALL_CONST_ITER(typename CloudType, cloud, iter) {
-    const typename CloudType::parcelType& p = iter();
-    const tetIndices tetIs(p.cell(), p.tetFace(), p.tetPt(), cloud.mesh());
-    const vector u = uAverage_->interpolate(p.position(), tetIs);
-    uSqrAverage_->add
+    tetPointWeight& tpw = parcelWeights[parcelI++];
+    tpw.set
     (
+      cloud.mesh(),
       p.position(),
-      tetIs,
-      p.nParticle()*p.mass()*magSqr(p.U() - u)
+      tetIndices{p.cell(), p.tetFace(), p.tetPt(), cloud.mesh()}
     );
+    const scalar m = p.nParticle()*p.mass();
+    volumeAverage_.add(tpw, p.nParticle()*p.volume());
+    rhoAverage_.add(tpw, m*p.rho());
+    uAverage_.add(tpw, m*p.U());
+    massAverage_.add(tpw, m);
+    weightAverage_.add(tpw, p.nParticle()*pow(p.volume(), 2.0/3.0));
   }
-  uSqrAverage_->average(massAverage_);
+  volumeAverage_.average();
+  massAverage_.average();
+  rhoAverage_.average(massAverage_);
+  uAverage_.average(massAverage_);
   // sauter mean radius
-  radiusAverage_() = volumeAverage_();
-  weightAverage = 0;
-  FOR_ALL_CONST_ITER(typename CloudType, cloud, iter) {
-    const typename CloudType::parcelType& p = iter();
-    const tetIndices tetIs{p.cell(), p.tetFace(), p.tetPt(), cloud.mesh()};
-    weightAverage.add
-    (
-      p.position(),
-      tetIs,
-      p.nParticle()*pow(p.volume(), 2.0/3.0)
-    );
-  }
-  weightAverage.average();
-  radiusAverage_->average(weightAverage);
-  // collision frequency
-  weightAverage = 0;
+  radiusAverage_ = volumeAverage_;
+  weightAverage_.average();
+  radiusAverage_.average(weightAverage_);
+  // squared velocity deviation and collision frequency
+  weightAverage_ = 0;
+  parcelI = 0;
   FOR_ALL_CONST_ITER(typename CloudType, cloud, iter) {
     const typename CloudType::parcelType& p = iter();
-    tetIndices tetIs{p.cell(), p.tetFace(), p.tetPt(), cloud.mesh()};
-    const scalar a = volumeAverage_->interpolate(p.position(), tetIs);
-    const scalar r = radiusAverage_->interpolate(p.position(), tetIs);
-    const vector u = uAverage_->interpolate(p.position(), tetIs);
+    const tetPointWeight& tpw = parcelWeights[parcelI++];
+    const scalar a = volumeAverage_.interpolate(tpw);
+    const scalar r = radiusAverage_.interpolate(tpw);
+    const vector u = uAverage_.interpolate(tpw);
+    uSqrAverage_.add(tpw, p.nParticle()*p.mass()*magSqr(p.U() - u));
     const scalar f = 0.75*a/pow3(r)*sqr(0.5*p.d() + r)*mag(p.U() - u);
-    frequencyAverage_->add(p.position(), tetIs, p.nParticle()*f*f);
-    weightAverage.add(p.position(), tetIs, p.nParticle()*f);
+    frequencyAverage_.add(tpw, p.nParticle()*f*f);
+    weightAverage_.add(tpw, p.nParticle()*f);
   }
-  frequencyAverage_->average(weightAverage);
+  uSqrAverage_.average(massAverage_);
+  frequencyAverage_.average(weightAverage_);
 }
 
 
@@ -159,12 +159,7 @@ void mousse::ReactingParcel<ParcelType>::setCellValues
 )
 {
   ParcelType::setCellValues(td, dt, cellI);
-  pc_ =
-    td.pInterp().interpolate
-    (
-      this->position(),
-      this->currentTetIndices()
-    );
+  pc_ = td.pInterp().interpolate(td.tetWeights());
   if (pc_ < td.cloud().constProps().pMin()) {
     if (debug) {
       WARNING_IN
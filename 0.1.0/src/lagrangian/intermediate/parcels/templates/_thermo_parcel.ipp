@@ -20,9 +20,8 @@ void mousse::ThermoParcel<ParcelType>::setCellValues
 )
 {
   ParcelType::setCellValues(td, dt, cellI);
-  tetIndices tetIs = this->currentTetIndices();
-  Cpc_ = td.CpInterp().interpolate(this->position(), tetIs);
-  Tc_ = td.TInterp().interpolate(this->position(), tetIs);
+  Cpc_ = td.CpInterp().interpolate(td.tetWeights());
+  Tc_ = td.TInterp().interpolate(td.tetWeights());
   if (Tc_ < td.cloud().constProps().TMin()) {
     if (debug) {
       WARNING_IN
@@ -113,9 +112,8 @@ void mousse::ThermoParcel<ParcelType>::calcSurfaceValues
   // Assuming thermo props vary linearly with T for small d(T)
   const scalar TRatio = Tc_/Ts;
   rhos = this->rhoc_*TRatio;
-  tetIndices tetIs = this->currentTetIndices();
-  mus = td.muInterp().interpolate(this->position(), tetIs)/TRatio;
-  kappas = td.kappaInterp().interpolate(this->position(), tetIs)/TRatio;
+  mus = td.muInterp().interpolate(td.tetWeights())/TRatio;
+  kappas = td.kappaInterp().interpolate(td.tetWeights())/TRatio;
   Pr = Cpc_*mus/kappas;
   Pr = max(ROOTVSMALL, Pr);
 }
@@ -239,8 +237,7 @@ mousse::scalar mousse::ThermoParcel<ParcelType>::calcHeatTransfer
   scalar ap = Tc_ + Sh/(As*htc);
   scalar bp = 6.0*(Sh/As + htc*(Tc_ - T_));
   if (td.cloud().radiation()) {
-    tetIndices tetIs = this->currentTetIndices();
-    const scalar Gc = td.GInterp().interpolate(this->position(), tetIs);
+    const scalar Gc = td.GInterp().interpolate(td.tetWeights());
     const scalar sigma = physicoChemical::sigma.value();
     const scalar epsilon = td.cloud().constProps().epsilon0();
     // Assume constant source
@@ -99,6 +99,17 @@ protected:
       vector& position,
       bool errorOnNotFound = true
     );
+    //- Find the cells that contain the supplied positions, as
+    //  findCellAtPosition but with one collective for all positions.
+    //  Returns whether every position has been found.
+    virtual boolList findCellsAtPositions
+    (
+      labelList& cellIs,
+      labelList& tetFaceIs,
+      labelList& tetPtIs,
+      UList<vector>& positions,
+      bool errorOnNotFound = true
+    );
     //- Set number of particles to inject given parcel properties
     virtual scalar setNumberOfParticles
     (
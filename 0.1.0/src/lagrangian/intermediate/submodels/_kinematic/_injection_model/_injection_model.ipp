@@ -125,6 +125,94 @@ bool mousse::InjectionModel<CloudType>::findCellAtPosition
 }
 
 
+template<class CloudType>
+mousse::boolList mousse::InjectionModel<CloudType>::findCellsAtPositions
+(
+  labelList& cellIs,
+  labelList& tetFaceIs,
+  labelList& tetPtIs,
+  UList<vector>& positions,
+  bool errorOnNotFound
+)
+{
+  const polyMesh& mesh = this->owner().mesh();
+  const volVectorField& cellCentres = this->owner().mesh().C();
+  const pointField p0{positions};
+  cellIs.setSize(positions.size());
+  tetFaceIs.setSize(positions.size());
+  tetPtIs.setSize(positions.size());
+  labelList procIs{positions.size(), -1};
+  FOR_ALL(positions, i) {
+    mesh.findCellFacePt(positions[i], cellIs[i], tetFaceIs[i], tetPtIs[i]);
+    if (cellIs[i] >= 0) {
+      procIs[i] = Pstream::myProcNo();
+    }
+  }
+  Pstream::listCombineGather(procIs, maxEqOp<label>());
+  Pstream::listCombineScatter(procIs);
+  // Last chance for the positions not found - find nearest cell and try
+  // that one - the point is probably on an edge
+  bool allFound = true;
+  FOR_ALL(positions, i) {
+    if (procIs[i] != Pstream::myProcNo()) {
+      cellIs[i] = -1;
+      tetFaceIs[i] = -1;
+      tetPtIs[i] = -1;
+    }
+    if (procIs[i] == -1) {
+      allFound = false;
+      const label cellI = mesh.findNearestCell(positions[i]);
+      if (cellI >= 0) {
+        positions[i] += SMALL*(cellCentres[cellI] - positions[i]);
+        if (mesh.pointInCell(positions[i], cellI)) {
+          procIs[i] = Pstream::myProcNo();
+          cellIs[i] = cellI;
+          mesh.findTetFacePt
+          (
+            cellI,
+            positions[i],
+            tetFaceIs[i],
+            tetPtIs[i]
+          );
+        }
+      }
+    }
+  }
+  if (!allFound) {
+    Pstream::listCombineGather(procIs, maxEqOp<label>());
+    Pstream::listCombineScatter(procIs);
+  }
+  boolList found{positions.size(), true};
+  FOR_ALL(positions, i) {
+    if (procIs[i] != Pstream::myProcNo()) {
+      cellIs[i] = -1;
+      tetFaceIs[i] = -1;
+      tetPtIs[i] = -1;
+    }
+    if (procIs[i] == -1) {
+      if (errorOnNotFound) {
+        FATAL_ERROR_IN
+        (
+          "mousse::InjectionModel<CloudType>::findCellsAtPositions"
+          "("
+          "  labelList&, "
+          "  labelList&, "
+          "  labelList&, "
+          "  UList<vector>&, "
+          "  bool"
+          ")"
+        )
+        << "Cannot find parcel injection cell. "
+        << "Parcel position = " << p0[i] << nl
+        << abort(FatalError);
+      }
+      found[i] = false;
+    }
+  }
+  return found;
+}
+
+
 template<class CloudType>
 mousse::scalar mousse::InjectionModel<CloudType>::setNumberOfParticles
 (
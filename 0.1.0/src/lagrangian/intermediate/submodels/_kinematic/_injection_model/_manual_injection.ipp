@@ -89,17 +89,21 @@ mousse::ManualInjection<CloudType>::~ManualInjection()
 template<class CloudType>
 void mousse::ManualInjection<CloudType>::updateMesh()
 {
+  const boolList found
+  {
+    this->findCellsAtPositions
+    (
+      injectorCells_,
+      injectorTetFaces_,
+      injectorTetPts_,
+      positions_,
+      !ignoreOutOfBounds_
+    )
+  };
   label nRejected = 0;
   PackedBoolList keep{positions_.size(), true};
-  FOR_ALL(positions_, pI) {
-    if (!this->findCellAtPosition
-        (
-          injectorCells_[pI],
-          injectorTetFaces_[pI],
-          injectorTetPts_[pI],
-          positions_[pI],
-          !ignoreOutOfBounds_
-        )) {
+  FOR_ALL(found, pI) {
+    if (!found[pI]) {
       keep[pI] = false;
       nRejected++;
     }
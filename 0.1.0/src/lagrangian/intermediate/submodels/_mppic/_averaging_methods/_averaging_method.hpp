@@ -12,6 +12,7 @@
 #include "iodictionary.hpp"
 #include "auto_ptr.hpp"
 #include "run_time_selection_tables.hpp"
+#include "tet_point_weight.hpp"
 
 
 namespace mousse {
@@ -86,6 +87,18 @@ public:
       const point position,
       const tetIndices& tetIs
     ) const = 0;
+    //- Add point value to interpolation with the precomputed weights
+    //  of the position in its tetrahedron
+    virtual void add(const tetPointWeight& tpw, const Type& value)
+    {
+      add(tpw.position(), tpw.tetIs(), value);
+    }
+    //- Interpolate with the precomputed weights of the position in its
+    //  tetrahedron
+    virtual Type interpolate(const tetPointWeight& tpw) const
+    {
+      return interpolate(tpw.position(), tpw.tetIs());
+    }
     //- Interpolate gradient
     virtual TypeGrad interpolateGrad
     (
@@ -99,6 +99,10 @@ public:
       const point position,
       const tetIndices& tetIs
     ) const;
+    //- Add point value to interpolation with precomputed weights
+    void add(const tetPointWeight& tpw, const Type& value);
+    //- Interpolate with precomputed weights
+    Type interpolate(const tetPointWeight& tpw) const;
     //- Interpolate gradient
     TypeGrad interpolateGrad
     (
@@ -144,6 +144,40 @@ Type mousse::AveragingMethods::Dual<Type>::interpolate
 }
 
 
+template<class Type>
+void mousse::AveragingMethods::Dual<Type>::add
+(
+  const tetPointWeight& tpw,
+  const Type& value
+)
+{
+  const FixedList<scalar, 4>& w = tpw.weights();
+  const FixedList<label, 3>& vertices = tpw.faceVertices();
+  const label cellI = tpw.cell();
+  dataCell_[cellI] += max(w[0], scalar(0))*value/(0.25*volumeCell_[cellI]);
+  for(label i = 0; i < 3; i ++) {
+    dataDual_[vertices[i]] +=
+      max(w[i+1], scalar(0))*value/(0.25*volumeDual_[vertices[i]]);
+  }
+}
+
+
+template<class Type>
+Type mousse::AveragingMethods::Dual<Type>::interpolate
+(
+  const tetPointWeight& tpw
+) const
+{
+  const FixedList<scalar, 4>& w = tpw.weights();
+  const FixedList<label, 3>& vertices = tpw.faceVertices();
+  return
+    max(w[0], scalar(0))*dataCell_[tpw.cell()]
+    + max(w[1], scalar(0))*dataDual_[vertices[0]]
+    + max(w[2], scalar(0))*dataDual_[vertices[1]]
+    + max(w[3], scalar(0))*dataDual_[vertices[2]];
+}
+
+
 template<class Type>
 typename mousse::AveragingMethods::Dual<Type>::TypeGrad
 mousse::AveragingMethods::Dual<Type>::interpolateGrad
@@ -82,14 +82,19 @@ template<class CloudType>
 void mousse::ThermoLookupTableInjection<CloudType>::updateMesh()
 {
   // Set/cache the injector cells
+  pointField positions{injectors_.size()};
   FOR_ALL(injectors_, i) {
-    this->findCellAtPosition
-    (
-      injectorCells_[i],
-      injectorTetFaces_[i],
-      injectorTetPts_[i],
-      injectors_[i].x()
-    );
+    positions[i] = injectors_[i].x();
+  }
+  this->findCellsAtPositions
+  (
+    injectorCells_,
+    injectorTetFaces_,
+    injectorTetPts_,
+    positions
+  );
+  FOR_ALL(injectors_, i) {
+    injectors_[i].x() = positions[i];
   }
 }
 
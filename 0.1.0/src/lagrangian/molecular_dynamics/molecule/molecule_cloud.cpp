@@ -82,6 +82,94 @@ void mousse::moleculeCloud::buildCellOccupancy()
 }
 
 
+mousse::scalar mousse::moleculeCloud::maxSiteExtent() const
+{
+  scalar extent = 0;
+  FOR_ALL(constPropList_, i) {
+    const Field<vector>& sites = constPropList_[i].siteReferencePositions();
+    FOR_ALL(sites, sI) {
+      extent = max(extent, mag(sites[sI]));
+    }
+  }
+  return extent;
+}
+
+
+bool mousse::moleculeCloud::neighbourListValid() const
+{
+  if (neighbourMols_.size() != size()) {
+    return false;
+  }
+  // Molecules deleted, created or transferred between processors change
+  // the sequence of molecules of the cloud
+  const scalar maxDisplacementSqr = sqr(0.5*pot_.neighbourListSkin());
+  label i = 0;
+  FOR_ALL_CONST_ITER(moleculeCloud, *this, mol) {
+    if (&mol() != neighbourMols_[i]
+        || mol().origProc() != neighbourOrigProcs_[i]
+        || mol().origId() != neighbourOrigIds_[i]
+        || magSqr(mol().position() - neighbourPositions_[i])
+         > maxDisplacementSqr) {
+      return false;
+    }
+    i++;
+  }
+  return true;
+}
+
+
+void mousse::moleculeCloud::buildNeighbourList()
+{
+  // Any site pair within the cut-off of a molecule pair further apart than
+  // this cannot be reached before one of the molecules moves half the skin
+  const scalar rList =
+    pot_.pairPotentials().rCutMax() + 2*maxSiteExtent()
+  + pot_.neighbourListSkin();
+  const scalar rListSqr = sqr(rList);
+  neighbourPairs_.clear();
+  const labelListList& dil = il_.dil();
+  FOR_ALL(dil, d) {
+    const DynamicList<molecule*>& cellIMols = cellOccupancy_[d];
+    FOR_ALL(cellIMols, cellIMolI) {
+      molecule* molI = cellIMols[cellIMolI];
+      FOR_ALL(dil[d], interactingCells) {
+        const DynamicList<molecule*>& cellJ =
+          cellOccupancy_[dil[d][interactingCells]];
+        FOR_ALL(cellJ, cellJMols) {
+          molecule* molJ = cellJ[cellJMols];
+          if (magSqr(molI->position() - molJ->position()) < rListSqr) {
+            neighbourPairs_.append(Pair<molecule*>{molI, molJ});
+          }
+        }
+      }
+      FOR_ALL(cellIMols, cellIOtherMols) {
+        molecule* molJ = cellIMols[cellIOtherMols];
+        if (molJ > molI
+            && magSqr(molI->position() - molJ->position()) < rListSqr) {
+          neighbourPairs_.append(Pair<molecule*>{molI, molJ});
+        }
+      }
+    }
+  }
+  neighbourMols_.setSize(size());
+  neighbourOrigProcs_.setSize(size());
+  neighbourOrigIds_.setSize(size());
+  neighbourPositions_.setSize(size());
+  label i = 0;
+  FOR_ALL_ITER(moleculeCloud, *this, mol) {
+    neighbourMols_[i] = &mol();
+    neighbourOrigProcs_[i] = mol().origProc();
+    neighbourOrigIds_[i] = mol().origId();
+    neighbourPositions_[i] = mol().position();
+    i++;
+  }
+  if (debug) {
+    Pout << "moleculeCloud: rebuilt neighbour list of "
+      << neighbourPairs_.size() << " pairs" << endl;
+  }
+}
+
+
 void mousse::moleculeCloud::calculatePairForce()
 {
   PstreamBuffers pBufs{Pstream::nonBlocking};
@@ -91,21 +179,32 @@ void mousse::moleculeCloud::calculatePairForce()
   molecule* molI = nullptr;
   molecule* molJ = nullptr;
 
-  {
+  if (pot_.neighbourListSkin() > 0) {
+    // Real-Real interactions from the neighbour list
+    if (!neighbourListValid()) {
+      buildNeighbourList();
+    }
+    FOR_ALL(neighbourPairs_, pairI) {
+      const Pair<molecule*>& molPair = neighbourPairs_[pairI];
+      evaluatePair(*molPair.first(), *molPair.second());
+    }
+  } else {
     // Real-Real interactions
     const labelListList& dil = il_.dil();
     FOR_ALL(dil, d) {
-      FOR_ALL(cellOccupancy_[d],cellIMols) {
-        molI = cellOccupancy_[d][cellIMols];
+      const DynamicList<molecule*>& cellIMols = cellOccupancy_[d];
+      FOR_ALL(cellIMols, cellIMolI) {
+        molI = cellIMols[cellIMolI];
         FOR_ALL(dil[d], interactingCells) {
-          List<molecule*> cellJ = cellOccupancy_[dil[d][interactingCells]];
+          const DynamicList<molecule*>& cellJ =
+            cellOccupancy_[dil[d][interactingCells]];
           FOR_ALL(cellJ, cellJMols) {
             molJ = cellJ[cellJMols];
             evaluatePair(*molI, *molJ);
           }
         }
-        FOR_ALL(cellOccupancy_[d], cellIOtherMols) {
-          molJ = cellOccupancy_[d][cellIOtherMols];
+        FOR_ALL(cellIMols, cellIOtherMols) {
+          molJ = cellIMols[cellIOtherMols];
           if (molJ > molI) {
             evaluatePair(*molI, *molJ);
           }
@@ -126,7 +225,7 @@ void mousse::moleculeCloud::calculatePairForce()
       IDLList<molecule>& refMols = referredMols[r];
       FOR_ALL_ITER(IDLList<molecule>, refMols, refMol) {
         FOR_ALL(realCells, rC) {
-          List<molecule*> cellI = cellOccupancy_[realCells[rC]];
+          const DynamicList<molecule*>& cellI = cellOccupancy_[realCells[rC]];
           FOR_ALL(cellI, cellIMols) {
             molI = cellI[cellIMols];
             evaluatePair(*molI, refMol());
@@ -716,9 +815,19 @@ mousse::moleculeCloud::moleculeCloud
   mesh_{mesh},
   pot_{pot},
   cellOccupancy_{mesh_.nCells()},
-  il_{mesh_, pot_.pairPotentials().rCutMax(), false},
+  il_
+  {
+    mesh_,
+    pot_.pairPotentials().rCutMax() + pot_.neighbourListSkin(),
+    false
+  },
   constPropList_(),
-  rndGen_{clock::getTime()}
+  rndGen_{clock::getTime()},
+  neighbourPairs_{},
+  neighbourMols_{},
+  neighbourOrigProcs_{},
+  neighbourOrigIds_{},
+  neighbourPositions_{}
 {
   if (readFields) {
     molecule::readFields(*this);
@@ -743,7 +852,12 @@ mousse::moleculeCloud::moleculeCloud
   pot_{pot},
   il_{mesh_, 0.0, false},
   constPropList_(),
-  rndGen_{clock::getTime()}
+  rndGen_{clock::getTime()},
+  neighbourPairs_{},
+  neighbourMols_{},
+  neighbourOrigProcs_{},
+  neighbourOrigIds_{},
+  neighbourPositions_{}
 {
   if (readFields) {
     molecule::readFields(*this);
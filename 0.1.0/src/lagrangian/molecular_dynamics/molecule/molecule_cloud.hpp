@@ -13,6 +13,7 @@
 #include "potential.hpp"
 #include "_interaction_lists.hpp"
 #include "label_vector.hpp"
+#include "pair.hpp"
 #include "random.hpp"
 #include "file_name.hpp"
 #include "constants.hpp"
@@ -35,11 +36,28 @@ private:
     InteractionLists<molecule> il_;
     List<molecule::constantProperties> constPropList_;
     Random rndGen_;
+    // Verlet neighbour list of the real-real interactions
+      //- Pairs of molecules closer than the cut-off plus the skin
+      DynamicList<Pair<molecule*>> neighbourPairs_;
+      //- Molecules in cloud order when the list was built
+      List<molecule*> neighbourMols_;
+      //- Original processor and id of the molecules
+      labelList neighbourOrigProcs_;
+      labelList neighbourOrigIds_;
+      //- Molecule positions when the list was built
+      List<point> neighbourPositions_;
   // Private Member Functions
     void buildConstProps();
     void setSiteSizesAndPositions();
     //- Determine which molecules are in which cells
     void buildCellOccupancy();
+    //- Return the maximum distance of a site from its molecule centre
+    scalar maxSiteExtent() const;
+    //- Return true if the neighbour list is valid for the current
+    //  molecules and positions
+    bool neighbourListValid() const;
+    //- Build the neighbour list from the direct interaction list
+    void buildNeighbourList();
     void calculatePairForce();
     inline void evaluatePair
     (
@@ -110,6 +128,13 @@ public:
       const scalar targetTemperature,
       const scalar measuredTemperature
     );
+    // Mapping
+      //- The interaction lists are only built for the mesh at
+      //  construction so the cloud cannot be redistributed
+      virtual bool redistributable() const
+      {
+        return false;
+      }
     // Access
       inline const polyMesh& mesh() const;
       inline const potential& pot() const;
@@ -140,12 +165,13 @@ inline void mousse::moleculeCloud::evaluatePair
   label idJ = molJ.id();
   const molecule::constantProperties& constPropI = constProps(idI);
   const molecule::constantProperties& constPropJ = constProps(idJ);
-  List<label> siteIdsI = constPropI.siteIds();
-  List<label> siteIdsJ = constPropJ.siteIds();
-  List<bool> pairPotentialSitesI = constPropI.pairPotentialSites();
-  List<bool> electrostaticSitesI = constPropI.electrostaticSites();
-  List<bool> pairPotentialSitesJ = constPropJ.pairPotentialSites();
-  List<bool> electrostaticSitesJ = constPropJ.electrostaticSites();
+  const List<label>& siteIdsI = constPropI.siteIds();
+  const List<label>& siteIdsJ = constPropJ.siteIds();
+  const List<bool>& pairPotentialSitesI = constPropI.pairPotentialSites();
+  const List<bool>& electrostaticSitesI = constPropI.electrostaticSites();
+  const List<bool>& pairPotentialSitesJ = constPropJ.pairPotentialSites();
+  const List<bool>& electrostaticSitesJ = constPropJ.electrostaticSites();
+  const vector rIJ = molI.position() - molJ.position();
   FOR_ALL(siteIdsI, sI) {
     label idsI{siteIdsI[sI]};
     FOR_ALL(siteIdsJ, sJ) {
@@ -154,15 +180,18 @@ inline void mousse::moleculeCloud::evaluatePair
         vector rsIsJ =
           molI.sitePositions()[sI] - molJ.sitePositions()[sJ];
         scalar rsIsJMagSq = magSqr(rsIsJ);
-        if (pairPot.rCutSqr(idsI, idsJ, rsIsJMagSq)) {
-          scalar rsIsJMag = mag(rsIsJ);
-          vector fsIsJ = (rsIsJ/rsIsJMag)*pairPot.force(idsI, idsJ, rsIsJMag);
+        const pairPotential& pairPotIJ =
+          pairPot.pairPotentialFunction(idsI, idsJ);
+        if (rsIsJMagSq < pairPotIJ.rCutSqr()) {
+          scalar rsIsJMag = sqrt(rsIsJMagSq);
+          scalar forceMag = 0;
+          scalar potentialEnergy = 0;
+          pairPotIJ.forceAndEnergy(rsIsJMag, forceMag, potentialEnergy);
+          vector fsIsJ = (rsIsJ/rsIsJMag)*forceMag;
           molI.siteForces()[sI] += fsIsJ;
           molJ.siteForces()[sJ] += -fsIsJ;
-          scalar potentialEnergy{pairPot.energy(idsI, idsJ, rsIsJMag)};
           molI.potentialEnergy() += 0.5*potentialEnergy;
           molJ.potentialEnergy() += 0.5*potentialEnergy;
-          vector rIJ = molI.position() - molJ.position();
           tensor virialContribution((rsIsJ*fsIsJ)*(rsIsJ & rIJ)/rsIsJMagSq);
           molI.rf() += virialContribution;
           molJ.rf() += virialContribution;
@@ -173,22 +202,18 @@ inline void mousse::moleculeCloud::evaluatePair
         molI.sitePositions()[sI] - molJ.sitePositions()[sJ];
         scalar rsIsJMagSq = magSqr(rsIsJ);
         if (rsIsJMagSq <= electrostatic.rCutSqr()) {
-          scalar rsIsJMag = mag(rsIsJ);
+          scalar rsIsJMag = sqrt(rsIsJMagSq);
           scalar chargeI = constPropI.siteCharges()[sI];
           scalar chargeJ = constPropJ.siteCharges()[sJ];
-          vector fsIsJ
-          {
-            (rsIsJ/rsIsJMag)*chargeI*chargeJ*electrostatic.force(rsIsJMag)
-          };
+          scalar forceMag = 0;
+          scalar potentialEnergy = 0;
+          electrostatic.forceAndEnergy(rsIsJMag, forceMag, potentialEnergy);
+          vector fsIsJ{(rsIsJ/rsIsJMag)*chargeI*chargeJ*forceMag};
           molI.siteForces()[sI] += fsIsJ;
           molJ.siteForces()[sJ] += -fsIsJ;
-          scalar potentialEnergy
-          {
-            chargeI*chargeJ*electrostatic.energy(rsIsJMag)
-          };
+          potentialEnergy *= chargeI*chargeJ;
           molI.potentialEnergy() += 0.5*potentialEnergy;
           molJ.potentialEnergy() += 0.5*potentialEnergy;
-          vector rIJ = molI.position() - molJ.position();
           tensor virialContribution{(rsIsJ*fsIsJ)*(rsIsJ & rIJ)/rsIsJMagSq};
           molI.rf() += virialContribution;
           molJ.rf() += virialContribution;
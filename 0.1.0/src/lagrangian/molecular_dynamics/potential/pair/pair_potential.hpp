@@ -82,6 +82,13 @@ public:
     inline scalar rCutSqr() const;
     scalar energy (const scalar r) const;
     scalar force (const scalar r) const;
+    //- Return the force and energy with a single table lookup
+    inline void forceAndEnergy
+    (
+      const scalar r,
+      scalar& f,
+      scalar& e
+    ) const;
     List<Pair<scalar>> energyTable() const;
     List<Pair<scalar>> forceTable() const;
     inline bool writeTables() const;
@@ -129,6 +136,27 @@ inline mousse::scalar mousse::pairPotential::rCutSqr() const
 }
 
 
+inline void mousse::pairPotential::forceAndEnergy
+(
+  const scalar r,
+  scalar& f,
+  scalar& e
+) const
+{
+  const scalar k_rIJ = (r - rMin_)/dr_;
+  const label k = label(k_rIJ);
+  if (k < 0) {
+    FATAL_ERROR_IN("pairPotential::forceAndEnergy(const scalar, ...) const")
+      << "r less than rMin in pair potential " << name_ << nl
+      << abort(FatalError);
+  }
+  const scalar w1 = k_rIJ - k;
+  const scalar w0 = k + 1 - k_rIJ;
+  f = w1*forceLookup_[k + 1] + w0*forceLookup_[k];
+  e = w1*energyLookup_[k + 1] + w0*energyLookup_[k];
+}
+
+
 inline bool mousse::pairPotential::writeTables() const
 {
   return writeTables_;
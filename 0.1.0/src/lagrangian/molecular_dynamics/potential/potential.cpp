@@ -104,6 +104,7 @@ void mousse::potential::potential::readPotentialDict()
   };
   potentialEnergyLimit_ =
     readScalar(potentialDict.lookup("potentialEnergyLimit"));
+  potentialDict.readIfPresent("neighbourListSkin", neighbourListSkin_);
   if (potentialDict.found("removalOrder")) {
     List<word> remOrd = potentialDict.lookup("removalOrder");
     removalOrder_.setSize(remOrd.size());
@@ -245,7 +246,8 @@ void mousse::potential::potential::readMdInitialiseDict
 // Constructors 
 mousse::potential::potential(const polyMesh& mesh)
 :
-  mesh_{mesh}
+  mesh_{mesh},
+  neighbourListSkin_{0}
 {
   readPotentialDict();
 }
@@ -258,7 +260,8 @@ mousse::potential::potential
   IOdictionary& idListDict
 )
 :
-  mesh_{mesh}
+  mesh_{mesh},
+  neighbourListSkin_{0}
 {
   readMdInitialiseDict(mdInitialiseDict, idListDict);
 }
@@ -25,6 +25,8 @@ class potential
     List<word> siteIdList_;
     label nPairPotIds_;
     scalar potentialEnergyLimit_;
+    //- Skin distance of the molecule neighbour lists, 0 to disable
+    scalar neighbourListSkin_;
     labelList removalOrder_;
     pairPotentialList pairPotentials_;
     tetherPotentialList tetherPotentials_;
@@ -60,6 +62,7 @@ public:
       inline const List<word>& idList() const;
       inline const List<word>& siteIdList() const;
       inline scalar potentialEnergyLimit() const;
+      inline scalar neighbourListSkin() const;
       inline label nPairPotentials() const;
       inline const labelList& removalOrder() const;
       inline const pairPotentialList& pairPotentials() const;
@@ -95,6 +98,12 @@ inline mousse::scalar mousse::potential::potentialEnergyLimit() const
 }
 
 
+inline mousse::scalar mousse::potential::neighbourListSkin() const
+{
+  return neighbourListSkin_;
+}
+
+
 inline mousse::label mousse::potential::nPairPotentials() const
 {
   return pairPotentials_.size();
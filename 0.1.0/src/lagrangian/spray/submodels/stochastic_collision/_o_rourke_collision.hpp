@@ -8,6 +8,8 @@
 //   mousse::ORourkeCollision
 // Description
 //   Collision model by P.J. O'Rourke.
+//   Only parcels in the same cell collide, so the parcels are binned by
+//   cell and the pairs are formed within each cell.
 
 #include "_stochastic_collision_model.hpp"
 #include "liquid_mixture_properties.hpp"
@@ -30,6 +32,14 @@ protected:
   // Protected Member Functions
     //- Main collision routine
     virtual void collide(const scalar dt);
+    //- Collide a pair of parcels and update the properties of those
+    //  whose mass has changed
+    void collidePair(const scalar dt, parcelType& p1, parcelType& p2);
+    //- Update the liquid properties and diameter of a parcel to its
+    //  new mass
+    void updateProperties(parcelType& p, const scalar m) const;
+    //- Remove coalesced parcels that fall below the minimum mass
+    void removeSmallParcels();
     //- Collide parcels and return true if mass has changed
     virtual bool collideParcels
     (
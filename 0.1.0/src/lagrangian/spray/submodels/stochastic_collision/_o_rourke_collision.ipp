@@ -14,39 +14,71 @@ using namespace mousse::constant::mathematical;
 template<class CloudType>
 void mousse::ORourkeCollision<CloudType>::collide(const scalar dt)
 {
-  label i = 0;
-  FOR_ALL_ITER(typename CloudType, this->owner(), iter1) {
-    label j = 0;
-    FOR_ALL_ITER(typename CloudType, this->owner(), iter2) {
-      if (j > i) {
-        parcelType& p1 = iter1();
-        parcelType& p2 = iter2();
-        scalar m1 = p1.nParticle()*p1.mass();
-        scalar m2 = p2.nParticle()*p2.mass();
-        bool massChanged = collideParcels(dt, p1, p2, m1, m2);
-        if (massChanged) {
-          if (m1 > ROOTVSMALL) {
-            const scalarField X(liquids_.X(p1.Y()));
-            p1.rho() = liquids_.rho(p1.pc(), p1.T(), X);
-            p1.Cp() = liquids_.Cp(p1.pc(), p1.T(), X);
-            p1.sigma() = liquids_.sigma(p1.pc(), p1.T(), X);
-            p1.mu() = liquids_.mu(p1.pc(), p1.T(), X);
-            p1.d() = cbrt(6.0*m1/(p1.nParticle()*p1.rho()*pi));
-          }
-          if (m2 > ROOTVSMALL) {
-            const scalarField X(liquids_.X(p2.Y()));
-            p2.rho() = liquids_.rho(p2.pc(), p2.T(), X);
-            p2.Cp() = liquids_.Cp(p2.pc(), p2.T(), X);
-            p2.sigma() = liquids_.sigma(p2.pc(), p2.T(), X);
-            p2.mu() = liquids_.mu(p2.pc(), p2.T(), X);
-            p2.d() = cbrt(6.0*m2/(p2.nParticle()*p2.rho()*pi));
-          }
-        }
+  // Bin the parcels by cell with a stable counting sort so that the pairs
+  // of every cell keep the cloud order
+  const label nCells = this->owner().mesh().nCells();
+  labelList cellStart{nCells + 1, 0};
+  FOR_ALL_CONST_ITER(typename CloudType, this->owner(), iter) {
+    cellStart[iter().cell() + 1]++;
+  }
+  for (label cellI = 0; cellI < nCells; cellI++) {
+    cellStart[cellI + 1] += cellStart[cellI];
+  }
+  List<parcelType*> cellParcels{this->owner().size()};
+  labelList cellFill{SubList<label>{cellStart, nCells}};
+  FOR_ALL_ITER(typename CloudType, this->owner(), iter) {
+    cellParcels[cellFill[iter().cell()]++] = &iter();
+  }
+  for (label cellI = 0; cellI < nCells; cellI++) {
+    for (label i = cellStart[cellI]; i < cellStart[cellI + 1]; i++) {
+      for (label j = i + 1; j < cellStart[cellI + 1]; j++) {
+        collidePair(dt, *cellParcels[i], *cellParcels[j]);
       }
-      j++;
     }
-    i++;
   }
+  removeSmallParcels();
+}
+
+
+template<class CloudType>
+void mousse::ORourkeCollision<CloudType>::collidePair
+(
+  const scalar dt,
+  parcelType& p1,
+  parcelType& p2
+)
+{
+  scalar m1 = p1.nParticle()*p1.mass();
+  scalar m2 = p2.nParticle()*p2.mass();
+  bool massChanged = collideParcels(dt, p1, p2, m1, m2);
+  if (massChanged) {
+    updateProperties(p1, m1);
+    updateProperties(p2, m2);
+  }
+}
+
+
+template<class CloudType>
+void mousse::ORourkeCollision<CloudType>::updateProperties
+(
+  parcelType& p,
+  const scalar m
+) const
+{
+  if (m > ROOTVSMALL) {
+    const scalarField X(liquids_.X(p.Y()));
+    p.rho() = liquids_.rho(p.pc(), p.T(), X);
+    p.Cp() = liquids_.Cp(p.pc(), p.T(), X);
+    p.sigma() = liquids_.sigma(p.pc(), p.T(), X);
+    p.mu() = liquids_.mu(p.pc(), p.T(), X);
+    p.d() = cbrt(6.0*m/(p.nParticle()*p.rho()*pi));
+  }
+}
+
+
+template<class CloudType>
+void mousse::ORourkeCollision<CloudType>::removeSmallParcels()
+{
   // remove coalesced parcels that fall below minimum mass threshold
   FOR_ALL_ITER(typename CloudType, this->owner(), iter) {
     parcelType& p = iter();
@@ -9,6 +9,11 @@
 // Description
 //   Trajectory collision model by N. Nordin, based on O'Rourke's collision
 //   model
+//   Candidate pairs are found with a spatial hash of the parcel positions
+//   whose bins span the largest collision distance of the time step, so
+//   only parcels in the same or neighbouring bins are tested.  The bin
+//   size uses the parcel velocities and diameters at the start of the
+//   collision step.
 
 #include "_o_rourke_collision.hpp"
 
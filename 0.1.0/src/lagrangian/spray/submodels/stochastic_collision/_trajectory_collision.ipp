@@ -3,13 +3,98 @@
 // Copyright (C) 2016 mousse project
 
 #include "_trajectory_collision.hpp"
+#include "hash_table.hpp"
+#include "dynamic_list.hpp"
 
 
 // Protected Member Functions 
 template<class CloudType>
 void mousse::TrajectoryCollision<CloudType>::collide(const scalar dt)
 {
-  ORourkeCollision<CloudType>::collide(dt);
+  typedef FixedList<label, 3> binKey;
+  List<parcelType*> parcels{this->owner().size()};
+  point origin{point::max};
+  point corner{point::min};
+  scalar UMax = 0;
+  scalar dMax = 0;
+  label nParcels = 0;
+  FOR_ALL_ITER(typename CloudType, this->owner(), iter) {
+    parcelType& p = iter();
+    parcels[nParcels++] = &p;
+    origin = min(origin, p.position());
+    corner = max(corner, p.position());
+    UMax = max(UMax, mag(p.U()));
+    dMax = max(dMax, p.d());
+  }
+  // Parcels approaching each other collide only when their distance is
+  // below |U1 - U2|*dt + (d1 + d2)/2, so all candidate partners lie in
+  // the same or a neighbouring bin of this size
+  scalar binSize = 2*UMax*dt + dMax;
+  if (nParcels < 2 || UMax < ROOTVSMALL) {
+    this->removeSmallParcels();
+    return;
+  }
+  // Limit the number of bins per direction to keep the keys in range
+  binSize = max(binSize, 1e-6*cmptMax(corner - origin));
+  // Bin the parcels with a spatial hash, then sort them by bin keeping
+  // the cloud order within each bin
+  HashTable<label, binKey, binKey::Hash<>> binIndex{2*nParcels};
+  DynamicList<binKey> binKeys{nParcels};
+  labelList parcelBin{nParcels};
+  FOR_ALL(parcels, i) {
+    const point& pos = parcels[i]->position();
+    binKey key;
+    for (direction cmpt = 0; cmpt < 3; cmpt++) {
+      key[cmpt] = label((pos[cmpt] - origin[cmpt])/binSize);
+    }
+    typename HashTable<label, binKey, binKey::Hash<>>::const_iterator fnd =
+      binIndex.find(key);
+    if (fnd == binIndex.end()) {
+      parcelBin[i] = binKeys.size();
+      binIndex.insert(key, binKeys.size());
+      binKeys.append(key);
+    } else {
+      parcelBin[i] = fnd();
+    }
+  }
+  const label nBins = binKeys.size();
+  labelList binStart{nBins + 1, 0};
+  FOR_ALL(parcelBin, i) {
+    binStart[parcelBin[i] + 1]++;
+  }
+  for (label binI = 0; binI < nBins; binI++) {
+    binStart[binI + 1] += binStart[binI];
+  }
+  labelList binParcels{nParcels};
+  labelList binFill{SubList<label>{binStart, nBins}};
+  FOR_ALL(parcelBin, i) {
+    binParcels[binFill[parcelBin[i]]++] = i;
+  }
+  // Visit every candidate pair once, with p1 ahead of p2 in the cloud
+  for (label binI = 0; binI < nBins; binI++) {
+    for (label nbr = 0; nbr < 27; nbr++) {
+      binKey key{binKeys[binI]};
+      key[0] += nbr % 3 - 1;
+      key[1] += (nbr/3) % 3 - 1;
+      key[2] += nbr/9 - 1;
+      typename HashTable<label, binKey, binKey::Hash<>>::const_iterator fnd =
+        binIndex.find(key);
+      if (fnd == binIndex.end()) {
+        continue;
+      }
+      const label nbrBinI = fnd();
+      for (label ii = binStart[binI]; ii < binStart[binI + 1]; ii++) {
+        const label i = binParcels[ii];
+        for (label jj = binStart[nbrBinI]; jj < binStart[nbrBinI + 1]; jj++) {
+          const label j = binParcels[jj];
+          if (j > i) {
+            this->collidePair(dt, *parcels[i], *parcels[j]);
+          }
+        }
+      }
+    }
+  }
+  this->removeSmallParcels();
 }
 
 
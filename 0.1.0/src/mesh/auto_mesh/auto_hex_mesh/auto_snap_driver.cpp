@@ -779,17 +779,82 @@ mousse::vectorField mousse::autoSnapDriver::calcNearestSurface
   pointField& nearestPoint,
   vectorField& nearestNormal
 )
+{
+  // Empty cache so all points are searched for
+  nearestSurfaceCache cache{0};
+  return calcNearestSurface
+  (
+    meshRefiner,
+    snapDist,
+    pp,
+    nearestPoint,
+    nearestNormal,
+    cache
+  );
+}
+
+
+mousse::vectorField mousse::autoSnapDriver::calcNearestSurface
+(
+  const meshRefinement& meshRefiner,
+  const scalarField& snapDist,
+  const indirectPrimitivePatch& pp,
+  pointField& nearestPoint,
+  vectorField& nearestNormal,
+  nearestSurfaceCache& cache
+)
 {
   Info << "Calculating patchDisplacement as distance to nearest surface"
     << " point ..." << endl;
   const pointField& localPoints = pp.localPoints();
   const refinementSurfaces& surfaces = meshRefiner.surfaces();
   const fvMesh& mesh = meshRefiner.mesh();
+  const bool calcNormal = (nearestNormal.size() == localPoints.size());
   // Displacement per patch point
   vectorField patchDisp{localPoints.size(), vector::zero};
   if (returnReduce(localPoints.size(), sumOp<label>()) > 0) {
     // Current surface snapped to
     labelList snapSurf{localPoints.size(), -1};
+    // Points to search the nearest surface for: the ones that moved
+    // since the cached search
+    const bool useCache =
+      cache.points_.size() == localPoints.size()
+      && (!calcNormal || cache.hitNormals_.size() == localPoints.size());
+    boolList isTestPoint{localPoints.size(), true};
+    boolList isReused{localPoints.size(), false};
+    if (useCache) {
+      FOR_ALL(localPoints, pointI) {
+        if (magSqr(localPoints[pointI] - cache.points_[pointI])
+            <= sqr(cache.tol_*snapDist[pointI])) {
+          isTestPoint[pointI] = false;
+          isReused[pointI] = true;
+          snapSurf[pointI] = cache.hitSurfaces_[pointI];
+          // Points without a surface are not displaced
+          if (snapSurf[pointI] != -1) {
+            patchDisp[pointI] =
+              cache.hitPoints_[pointI] - localPoints[pointI];
+            if (calcNormal) {
+              nearestPoint[pointI] = cache.hitPoints_[pointI];
+              nearestNormal[pointI] = cache.hitNormals_[pointI];
+            }
+          }
+        }
+      }
+    }
+    // In debug mode the reused points are searched as well and checked
+    // against the cached result
+    const labelList cachedSurf{snapSurf};
+    const vectorField cachedDisp{patchDisp};
+    if (debug && useCache) {
+      isTestPoint = true;
+      snapSurf = -1;
+      patchDisp = vector::zero;
+    }
+    const labelList testPoints{findIndices(isTestPoint, true)};
+    Info << "Searching nearest surface for "
+      << returnReduce(testPoints.size(), sumOp<label>()) << " of "
+      << returnReduce(localPoints.size(), sumOp<label>())
+      << " patch points" << endl;
     // Divide surfaces into zoned and unzoned
     const labelList zonedSurfaces =
       surfaceZonesInfo::getNamedSurfaces
@@ -805,40 +870,41 @@ mousse::vectorField mousse::autoSnapDriver::calcNearestSurface
     {
       List<pointIndexHit> hitInfo;
       labelList hitSurface;
-      if (nearestNormal.size() == localPoints.size()) {
+      if (calcNormal) {
         labelList hitRegion;
         vectorField hitNormal;
         surfaces.findNearestRegion
           (
             unzonedSurfaces,
-            localPoints,
-            sqr(snapDist),
+            pointField(localPoints, testPoints),
+            sqr(scalarField(snapDist, testPoints)),
             hitSurface,
             hitInfo,
             hitRegion,
             hitNormal
           );
-        FOR_ALL(hitInfo, pointI) {
-          if (hitInfo[pointI].hit()) {
-            nearestPoint[pointI] = hitInfo[pointI].hitPoint();
-            nearestNormal[pointI] = hitNormal[pointI];
+        FOR_ALL(hitInfo, i) {
+          if (hitInfo[i].hit()) {
+            label pointI = testPoints[i];
+            nearestPoint[pointI] = hitInfo[i].hitPoint();
+            nearestNormal[pointI] = hitNormal[i];
           }
         }
       } else {
         surfaces.findNearest
           (
             unzonedSurfaces,
-            localPoints,
-            sqr(snapDist),        // sqr of attract distance
+            pointField(localPoints, testPoints),
+            sqr(scalarField(snapDist, testPoints)), // sqr of attract dist
             hitSurface,
             hitInfo
           );
       }
-      FOR_ALL(hitInfo, pointI) {
-        if (hitInfo[pointI].hit()) {
-          patchDisp[pointI] =
-            hitInfo[pointI].hitPoint() - localPoints[pointI];
-          snapSurf[pointI] = hitSurface[pointI];
+      FOR_ALL(hitInfo, i) {
+        if (hitInfo[i].hit()) {
+          label pointI = testPoints[i];
+          patchDisp[pointI] = hitInfo[i].hitPoint() - localPoints[pointI];
+          snapSurf[pointI] = hitSurface[i];
         }
       }
     }
@@ -861,10 +927,18 @@ mousse::vectorField mousse::autoSnapDriver::calcNearestSurface
             faceZoneName
           )
       };
+      // Only the points searched for
+      label nZoneTest = 0;
+      FOR_ALL(zonePointIndices, j) {
+        if (isTestPoint[zonePointIndices[j]]) {
+          zonePointIndices[nZoneTest++] = zonePointIndices[j];
+        }
+      }
+      zonePointIndices.setSize(nZoneTest);
       // Find nearest for points both on faceZone and pp.
       List<pointIndexHit> hitInfo;
       labelList hitSurface;
-      if (nearestNormal.size() == localPoints.size()) {
+      if (calcNormal) {
         labelList hitRegion;
         vectorField hitNormal;
         surfaces.findNearestRegion
@@ -905,6 +979,50 @@ mousse::vectorField mousse::autoSnapDriver::calcNearestSurface
         }
       }
     }
+    // Store the nearest points searched for. The reused ones keep the
+    // position they were searched from so small movements do not add up.
+    if (!useCache) {
+      cache.points_.setSize(localPoints.size());
+      cache.hitPoints_.setSize(localPoints.size());
+      cache.hitSurfaces_.setSize(localPoints.size());
+      cache.hitNormals_.setSize(calcNormal ? localPoints.size() : 0);
+    }
+    if (debug && useCache) {
+      label nDiffer = 0;
+      FOR_ALL(isReused, pointI) {
+        if (isReused[pointI]
+            && ((snapSurf[pointI] == -1) != (cachedSurf[pointI] == -1)
+                || mag(patchDisp[pointI] - cachedDisp[pointI])
+                 > 2*cache.tol_*snapDist[pointI] + SMALL)) {
+          nDiffer++;
+        }
+      }
+      Info << "Reused nearest surface points differing from a search: "
+        << returnReduce(nDiffer, sumOp<label>()) << endl;
+      // Continue with the reused results as without debug
+      FOR_ALL(isReused, pointI) {
+        if (isReused[pointI]) {
+          snapSurf[pointI] = cachedSurf[pointI];
+          patchDisp[pointI] = cachedDisp[pointI];
+          if (calcNormal && snapSurf[pointI] != -1) {
+            nearestPoint[pointI] = cache.hitPoints_[pointI];
+            nearestNormal[pointI] = cache.hitNormals_[pointI];
+          }
+        }
+      }
+    }
+    FOR_ALL(testPoints, i) {
+      label pointI = testPoints[i];
+      if (isReused[pointI]) {
+        continue;
+      }
+      cache.points_[pointI] = localPoints[pointI];
+      cache.hitPoints_[pointI] = localPoints[pointI] + patchDisp[pointI];
+      cache.hitSurfaces_[pointI] = snapSurf[pointI];
+      if (calcNormal) {
+        cache.hitNormals_[pointI] = nearestNormal[pointI];
+      }
+    }
     // Check if all points are being snapped
     FOR_ALL(snapSurf, pointI) {
       if (snapSurf[pointI] == -1) {
@@ -1517,6 +1635,8 @@ void mousse::autoSnapDriver::doSnap
     vectorField patchAttraction;
     // Constraints at feature
     List<pointConstraint> patchConstraints;
+    // Nearest surface points of the previous iteration
+    nearestSurfaceCache nearestCache{snapParams.nearestReuseTol()};
     for (label iter = 0; iter < nFeatIter; iter++) {
       Info << nl
         << "Morph iteration " << iter << nl
@@ -1539,7 +1659,8 @@ void mousse::autoSnapDriver::doSnap
           snapDist,
           pp,
           nearestPoint,
-          nearestNormal
+          nearestNormal,
+          nearestCache
         );
       // Override displacement at thin gaps
       if (snapParams.detectNearSurfacesSnap()) {
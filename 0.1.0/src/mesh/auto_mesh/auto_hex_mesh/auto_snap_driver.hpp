@@ -394,6 +394,29 @@ class autoSnapDriver
           List<pointConstraint>& patchConstraints
         ) const;
 public:
+  // Public data types
+    //- Nearest surface points of the patch points from the previous snap
+    //  iteration. Reused for the points that moved less than tol_ times
+    //  their snap distance since.
+    class nearestSurfaceCache
+    {
+    public:
+      //- Relative movement below which the nearest point is reused
+      scalar tol_;
+      //- Patch point positions at the last query
+      pointField points_;
+      //- Nearest surface point, the patch point itself if none found
+      pointField hitPoints_;
+      //- Surface normal at the nearest point, if requested
+      vectorField hitNormals_;
+      //- Surface of the nearest point, -1 if none found
+      labelList hitSurfaces_;
+      //- Construct with reuse tolerance
+      nearestSurfaceCache(const scalar tol)
+      :
+        tol_{tol}
+      {}
+    };
   //- Runtime type information
   CLASS_NAME("autoSnapDriver");
   // Constructors
@@ -462,6 +485,17 @@ public:
         pointField& nearestPoint,
         vectorField& nearestNormal
       );
+      //- As above but only querying the patch points that moved with
+      //  respect to the cache, which is updated
+      static vectorField calcNearestSurface
+      (
+        const meshRefinement& meshRefiner,
+        const scalarField& snapDist,
+        const indirectPrimitivePatch&,
+        pointField& nearestPoint,
+        vectorField& nearestNormal,
+        nearestSurfaceCache& cache
+      );
       ////- Per patch point calculate point on nearest surface. Set as
       ////  boundary conditions of motionSmoother displacement field.
       ////  Return displacement of patch points.
@@ -111,13 +111,18 @@ void mousse::medialAxisMeshMover::smoothPatchNormals
       edgeWeights,
       invSumWeight
     );
+  // Coupled points, for synchronising the weighted sums
+  const labelPairList coupledPoints
+  {
+    meshRefinement::coupledPoints(mesh(), meshPoints)
+  };
   vectorField average;
   for (label iter = 0; iter < nSmoothDisp; iter++) {
     meshRefinement::weightedSum
       (
         mesh(),
         isPatchMasterEdge,
-        meshPoints,
+        coupledPoints,
         edges,
         edgeWeights,
         normals,
@@ -179,13 +184,18 @@ void mousse::medialAxisMeshMover::smoothNormals
       edgeWeights,
       invSumWeight
     );
+  // Coupled points, for synchronising the weighted sums
+  const labelPairList coupledPoints
+  {
+    meshRefinement::coupledPoints(mesh(), meshPoints)
+  };
   vectorField average;
   for (label iter = 0; iter < nSmoothDisp; iter++) {
     meshRefinement::weightedSum
       (
         mesh(),
         isMeshMasterEdge,
-        meshPoints,
+        coupledPoints,
         edges,
         edgeWeights,
         normals,
@@ -697,15 +707,20 @@ void mousse::medialAxisMeshMover::minSmoothField
       edgeWeights,
       invSumWeight
     );
+  // Coupled points, for synchronising the weighted sums
+  const labelPairList coupledPoints
+  {
+    meshRefinement::coupledPoints(mesh(), meshPoints)
+  };
   // Get smoothly varying patch field.
   Info << typeName << " : Smoothing field ..." << endl;
+  scalarField average{pp.nPoints()};
   for (label iter = 0; iter < nSmoothDisp; iter++) {
-    scalarField average{pp.nPoints()};
     meshRefinement::weightedSum
       (
         mesh(),
         isPatchMasterEdge,
-        meshPoints,
+        coupledPoints,
         edges,
         edgeWeights,
         field,
@@ -1053,6 +1068,11 @@ void mousse::medialAxisMeshMover::smoothLambdaMuDisplacement
       edgeWeights,
       invSumWeight
     );
+  // Coupled points, for synchronising the weighted sums
+  const labelPairList coupledPoints
+  {
+    meshRefinement::coupledPoints(mesh(), meshPoints)
+  };
   // Get smoothly varying patch field.
   Info << typeName << " : Smoothing displacement ..." << endl;
   const scalar lambda = 0.33;
@@ -1063,7 +1083,7 @@ void mousse::medialAxisMeshMover::smoothLambdaMuDisplacement
       (
         mesh(),
         isMeshMasterEdge,
-        meshPoints,
+        coupledPoints,
         edges,
         edgeWeights,
         displacement,
@@ -1079,7 +1099,7 @@ void mousse::medialAxisMeshMover::smoothLambdaMuDisplacement
       (
         mesh(),
         isMeshMasterEdge,
-        meshPoints,
+        coupledPoints,
         edges,
         edgeWeights,
         displacement,
@@ -1100,6 +1100,28 @@ void mousse::meshRefinement::checkCoupledFaceZones(const polyMesh& mesh)
 }
 
 
+mousse::labelPairList mousse::meshRefinement::coupledPoints
+(
+  const polyMesh& mesh,
+  const labelList& meshPoints
+)
+{
+  const Map<label>& mpm = mesh.globalData().coupledPatch().meshPointMap();
+  labelPairList coupled{min(meshPoints.size(), mpm.size())};
+  label nCoupled = 0;
+  if (mpm.size()) {
+    FOR_ALL(meshPoints, i) {
+      Map<label>::const_iterator iter = mpm.find(meshPoints[i]);
+      if (iter != mpm.end()) {
+        coupled[nCoupled++] = labelPair{i, iter()};
+      }
+    }
+  }
+  coupled.setSize(nCoupled);
+  return coupled;
+}
+
+
 void mousse::meshRefinement::calculateEdgeWeights
 (
   const polyMesh& mesh,
@@ -566,6 +566,28 @@ public:
         const Field<Type>& data,
         Field<Type>& sum
       );
+      //- Helper: coupled points among meshPoints as (index in
+      //  meshPoints, point of the globalMeshData coupled patch) pairs.
+      //  Avoids searching the coupled patch on every weightedSum in
+      //  smoothing loops.
+      static labelPairList coupledPoints
+      (
+        const polyMesh& mesh,
+        const labelList& meshPoints
+      );
+      //- Helper: weighted sum as above given the coupled points of the
+      //  data
+      template<class Type>
+      static void weightedSum
+      (
+        const polyMesh& mesh,
+        const PackedBoolList& isMasterEdge,
+        const labelPairList& coupledPoints,
+        const edgeList& edges,
+        const scalarField& edgeWeights,
+        const Field<Type>& data,
+        Field<Type>& sum
+      );
     // Refinement
       //- Is local topology a small gap?
       bool isGap
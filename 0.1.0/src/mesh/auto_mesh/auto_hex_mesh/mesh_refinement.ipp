@@ -241,7 +241,41 @@ void mousse::meshRefinement::weightedSum
       << " meshPoints:" << meshPoints.size()
       << abort(FatalError);
   }
-  sum.setSize(meshPoints.size());
+  weightedSum
+  (
+    mesh,
+    isMasterEdge,
+    coupledPoints(mesh, meshPoints),
+    edges,
+    edgeWeights,
+    pointData,
+    sum
+  );
+}
+
+
+template<class Type>
+void mousse::meshRefinement::weightedSum
+(
+  const polyMesh& mesh,
+  const PackedBoolList& isMasterEdge,
+  const labelPairList& coupledPoints,
+  const edgeList& edges,
+  const scalarField& edgeWeights,
+  const Field<Type>& pointData,
+  Field<Type>& sum
+)
+{
+  if (edges.size() != isMasterEdge.size()
+      || edges.size() != edgeWeights.size()) {
+    FATAL_ERROR_IN("meshRefinement::weightedSum(..)")
+      << "Inconsistent sizes for edge data:"
+      << " isMasterEdge:" << isMasterEdge.size()
+      << " edgeWeights:" << edgeWeights.size()
+      << " edges:" << edges.size()
+      << abort(FatalError);
+  }
+  sum.setSize(pointData.size());
   sum = pTraits<Type>::zero;
   FOR_ALL(edges, edgeI) {
     if (isMasterEdge[edgeI]) {
@@ -253,13 +287,24 @@ void mousse::meshRefinement::weightedSum
       sum[v1] += eWeight*pointData[v0];
     }
   }
-  syncTools::syncPointList
-    (
-      mesh,
-      meshPoints,
-      sum,
-      plusEqOp<Type>(),
-      pTraits<Type>::zero     // null value
-    );
+  // Add the sums of the coupled points
+  const globalMeshData& gd = mesh.globalData();
+  List<Type> cppFld{gd.coupledPatch().nPoints(), pTraits<Type>::zero};
+  FOR_ALL(coupledPoints, i) {
+    cppFld[coupledPoints[i].second()] = sum[coupledPoints[i].first()];
+  }
+  globalMeshData::syncData
+  (
+    cppFld,
+    gd.globalPointSlaves(),
+    gd.globalPointTransformedSlaves(),
+    gd.globalPointSlavesMap(),
+    gd.globalTransforms(),
+    plusEqOp<Type>(),
+    mapDistribute::transform()
+  );
+  FOR_ALL(coupledPoints, i) {
+    sum[coupledPoints[i].first()] = cppFld[coupledPoints[i].second()];
+  }
 }
 
@@ -18,6 +18,7 @@
 #include "obj_stream.hpp"
 #include "cell_set.hpp"
 #include "tree_data_cell.hpp"
+#include "cpu_time.hpp"
 
 
 // Static Data Members
@@ -566,17 +567,22 @@ mousse::label mousse::meshRefinement::markInternalRefinement
   const labelList& cellLevel = meshCutter_.cellLevel();
   const pointField& cellCentres = mesh_.cellCentres();
   label oldNRefine = nRefine;
+  // Cells at or above the highest shell level can not be refined by any
+  // shell so are not tested
+  const label maxShellLevel = shells_.maxLevel();
   // Collect cells to test
   pointField testCc{cellLevel.size()-nRefine};
   labelList testLevels{cellLevel.size()-nRefine};
   label testI = 0;
   FOR_ALL(cellLevel, cellI) {
-    if (refineCell[cellI] == -1) {
+    if (refineCell[cellI] == -1 && cellLevel[cellI] < maxShellLevel) {
       testCc[testI] = cellCentres[cellI];
       testLevels[testI] = cellLevel[cellI];
       testI++;
     }
   }
+  testCc.setSize(testI);
+  testLevels.setSize(testI);
   // Do test to see whether cells is inside/outside shell with higher level
   labelList maxLevel;
   shells_.findHigherLevel(testCc, testLevels, maxLevel);
@@ -584,7 +590,7 @@ mousse::label mousse::meshRefinement::markInternalRefinement
   // now just reloop in same order.
   testI = 0;
   FOR_ALL(cellLevel, cellI) {
-    if (refineCell[cellI] == -1) {
+    if (refineCell[cellI] == -1 && cellLevel[cellI] < maxShellLevel) {
       if (maxLevel[testI] > testLevels[testI]) {
         bool reachedLimit =
           !markForRefine
@@ -1416,10 +1422,16 @@ mousse::labelList mousse::meshRefinement::refineCandidates
     // index of the surface it intersects.
     labelList refineCell{mesh_.nCells(), -1};
     label nRefine = 0;
+    // CPU time per marking phase
+    const cpuTime timer;
+    DynamicList<word> phaseNames;
+    DynamicList<scalar> phaseTimes;
     // Swap neighbouring cell centres and cell level
     labelList neiLevel{mesh_.nFaces()-mesh_.nInternalFaces()};
     pointField neiCc{mesh_.nFaces()-mesh_.nInternalFaces()};
     calcNeighbourData(neiLevel, neiCc);
+    phaseNames.append("neighbour data");
+    phaseTimes.append(timer.cpuTimeIncrement());
     // Cells pierced by feature lines
     if (featureRefinement) {
       label nFeatures =
@@ -1432,6 +1444,8 @@ mousse::labelList mousse::meshRefinement::refineCandidates
         );
       Info << "Marked for refinement due to explicit features             "
         << ": " << nFeatures << " cells."  << endl;
+      phaseNames.append("features");
+      phaseTimes.append(timer.cpuTimeIncrement());
     }
     // Inside distance-to-feature shells
     if (featureDistanceRefinement) {
@@ -1444,6 +1458,8 @@ mousse::labelList mousse::meshRefinement::refineCandidates
         );
       Info << "Marked for refinement due to distance to explicit features "
         ": " << nShell << " cells."  << endl;
+      phaseNames.append("feature distance");
+      phaseTimes.append(timer.cpuTimeIncrement());
     }
     // Inside refinement shells
     if (internalRefinement) {
@@ -1456,6 +1472,8 @@ mousse::labelList mousse::meshRefinement::refineCandidates
         );
       Info << "Marked for refinement due to refinement shells             "
         << ": " << nShell << " cells."  << endl;
+      phaseNames.append("shells");
+      phaseTimes.append(timer.cpuTimeIncrement());
     }
     // Refinement based on intersection of surface
     if (surfaceRefinement) {
@@ -1470,6 +1488,8 @@ mousse::labelList mousse::meshRefinement::refineCandidates
         );
       Info << "Marked for refinement due to surface intersection          "
         << ": " << nSurf << " cells."  << endl;
+      phaseNames.append("surface");
+      phaseTimes.append(timer.cpuTimeIncrement());
     }
     // Refinement based on curvature of surface
     if (curvatureRefinement && (curvature >= -1 && curvature <= 1)
@@ -1486,6 +1506,8 @@ mousse::labelList mousse::meshRefinement::refineCandidates
         );
       Info << "Marked for refinement due to curvature/regions             "
         << ": " << nCurv << " cells."  << endl;
+      phaseNames.append("curvature");
+      phaseTimes.append(timer.cpuTimeIncrement());
     }
     const scalar planarCos = mousse::cos(degToRad(planarAngle));
     if (gapRefinement && (planarCos >= -1 && planarCos <= 1)
@@ -1504,7 +1526,18 @@ mousse::labelList mousse::meshRefinement::refineCandidates
         );
       Info << "Marked for refinement due to close opposite surfaces       "
         << ": " << nGap << " cells."  << endl;
+      phaseNames.append("gap");
+      phaseTimes.append(timer.cpuTimeIncrement());
+    }
+    // Report the slowest processor per phase
+    Pstream::listCombineGather(phaseTimes, maxEqOp<scalar>());
+    Info << "Refinement marking CPU time per phase (slowest processor):"
+      << nl;
+    FOR_ALL(phaseNames, phaseI) {
+      Info << "    " << phaseNames[phaseI] << " : " << phaseTimes[phaseI]
+        << " s" << nl;
     }
+    Info << "    total : " << timer.elapsedCpuTime() << " s" << endl;
     // Pack cells-to-refine
     cellsToRefine.setSize(nRefine);
     nRefine = 0;
@@ -25,7 +25,8 @@ mousse::refinementSurfaces::refinementSurfaces
   surfaces_{surfacesDict.size()},
   names_{surfacesDict.size()},
   surfZones_{surfacesDict.size()},
-  regionOffset_{surfacesDict.size()}
+  regionOffset_{surfacesDict.size()},
+  maxMinLevel_{-1}
 {
   // Wildcard specification : loop over all surface, all regions
   // and try to find a match.
@@ -208,6 +209,7 @@ mousse::refinementSurfaces::refinementSurfaces
       patchInfo_.set(globalRegionI, iter()().clone());
     }
   }
+  maxMinLevel_ = max(maxMinLevel_, max(minLevel_));
 }
 
 
@@ -232,6 +234,7 @@ mousse::refinementSurfaces::refinementSurfaces
   regionOffset_{regionOffset},
   minLevel_{minLevel},
   maxLevel_{maxLevel},
+  maxMinLevel_{max(-1, max(minLevel))},
   gapLevel_{gapLevel},
   perpendicularAngle_{perpendicularAngle},
   patchInfo_{patchInfo.size()}
@@ -291,6 +294,7 @@ void mousse::refinementSurfaces::setMinLevelFields
     FOR_ALL(minLevelField, i) {
       minLevelField[i] = max(minLevelField[i], shellLevel[i]);
     }
+    maxMinLevel_ = max(maxMinLevel_, gMax(minLevelField));
     // Store minLevelField on surface
     const_cast<searchableSurface&>(geom).setField(minLevelField);
   }
@@ -315,6 +319,45 @@ void mousse::refinementSurfaces::findHigherIntersection
   if (surfaces_.empty()) {
     return;
   }
+  // Segments at or above the highest level of all surfaces cannot find a
+  // higher intersection so are not intersected. Every processor does the
+  // same intersections below whether it filters or not.
+  label nTest = 0;
+  FOR_ALL(currentLevel, i) {
+    if (currentLevel[i] < maxMinLevel_) {
+      nTest++;
+    }
+  }
+  if (nTest < start.size()) {
+    pointField testStart{nTest};
+    pointField testEnd{nTest};
+    labelList testLevel{nTest};
+    labelList testToPoint{nTest};
+    nTest = 0;
+    FOR_ALL(currentLevel, i) {
+      if (currentLevel[i] < maxMinLevel_) {
+        testStart[nTest] = start[i];
+        testEnd[nTest] = end[i];
+        testLevel[nTest] = currentLevel[i];
+        testToPoint[nTest++] = i;
+      }
+    }
+    labelList testSurfaces;
+    labelList testSurfaceLevel;
+    findHigherIntersection
+    (
+      testStart,
+      testEnd,
+      testLevel,
+      testSurfaces,
+      testSurfaceLevel
+    );
+    FOR_ALL(testToPoint, i) {
+      surfaces[testToPoint[i]] = testSurfaces[i];
+      surfaceLevel[testToPoint[i]] = testSurfaceLevel[i];
+    }
+    return;
+  }
   if (surfaces_.size() == 1) {
     // Optimisation: single segmented surface. No need to duplicate
     // point storage.
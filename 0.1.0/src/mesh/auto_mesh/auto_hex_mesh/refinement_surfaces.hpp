@@ -43,6 +43,9 @@ class refinementSurfaces
     labelList minLevel_;
     //- From global region number to refinement level
     labelList maxLevel_;
+    //- Highest refinement level of any region or minLevel field, i.e.
+    //  the highest level findHigherIntersection can return
+    label maxMinLevel_;
     //- From global region number to small-gap level
     labelList gapLevel_;
     //- From global region number to perpendicular angle
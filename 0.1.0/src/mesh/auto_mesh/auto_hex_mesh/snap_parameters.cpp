@@ -23,6 +23,7 @@ mousse::snapParameters::snapParameters(const dictionary& dict)
   detectNearSurfacesSnap_
   {
     dict.lookupOrDefault("detectNearSurfacesSnap", true)
-  }
+  },
+  nearestReuseTol_{dict.lookupOrDefault<scalar>("nearestReuseTolerance", 0)}
 {}
 
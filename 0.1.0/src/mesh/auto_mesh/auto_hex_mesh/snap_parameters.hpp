@@ -29,6 +29,7 @@ class snapParameters
     const Switch implicitFeatureSnap_;
     const Switch multiRegionFeatureSnap_;
     const Switch detectNearSurfacesSnap_;
+    const scalar nearestReuseTol_;
 public:
   // Constructors
     //- Construct from dictionary
@@ -57,6 +58,11 @@ public:
       Switch implicitFeatureSnap() const { return implicitFeatureSnap_; }
       Switch multiRegionFeatureSnap() const { return multiRegionFeatureSnap_; }
       Switch detectNearSurfacesSnap() const { return detectNearSurfacesSnap_; }
+      //- Movement of a patch point between snapping iterations, relative
+      //  to its snap distance, below which its nearest surface point is
+      //  not searched for again. 0 only reuses it for points that did not
+      //  move.
+      scalar nearestReuseTol() const { return nearestReuseTol_; }
 };
 
 }  // namespace mousse
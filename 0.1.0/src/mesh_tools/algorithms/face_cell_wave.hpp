@@ -22,6 +22,8 @@
 #include "bool_list.hpp"
 #include "label_list.hpp"
 #include "primitive_fields_fwd.hpp"
+#include "dynamic_list.hpp"
+#include "pstream_buffers.hpp"
 #include "class_name.hpp"
 
 
@@ -57,6 +59,15 @@ class FaceCellWave
     boolList changedCell_;
     labelList changedCells_;
     label nChangedCells_;
+    //- Is patch cyclic or processor, i.e. are its changed faces kept
+    boolList coupledPatch_;
+    //- Changed faces of the cyclic and processor patches, in patch face
+    //  numbering
+    List<DynamicList<label>> changedPatchFaces_;
+    //- Information of the changed faces of a patch to transfer
+    DynamicList<Type> changedPatchFacesInfo_;
+    //- Buffers for the transfers across processor patches
+    PstreamBuffers pBufs_;
     //- Contains cyclics
     const bool hasCyclicPatches_;
     //- Contains cyclicAMI
@@ -67,6 +78,8 @@ class FaceCellWave
     label nUnvisitedCells_;
     label nUnvisitedFaces_;
   // Private Member Functions
+    //- Mark face as changed
+    inline void setChangedFace(const label faceI);
     //- Updates cellInfo with information from neighbour. Updates all
     //  statistics.
     bool updateCell
@@ -110,15 +123,9 @@ class FaceCellWave
         const labelList&,
         const List<Type>&
       );
-      //- Extract info for single patch only
-      label getChangedPatchFaces
-      (
-        const polyPatch& patch,
-        const label startFaceI,
-        const label nFaces,
-        labelList& changedPatchFaces,
-        List<Type>& changedPatchFacesInfo
-      ) const;
+      //- Extract info of the changed faces of a cyclic or processor
+      //  patch into changedPatchFacesInfo_. Returns the changed faces.
+      const labelList& getChangedPatchFaces(const polyPatch& patch);
       //- Handle leaving domain. Implementation referred to Type
       void leaveDomain
       (
@@ -77,6 +77,33 @@ class combine
 
 
 // Private Member Functions 
+// Mark faceI as changed, both on list and on face itself. The changed
+// faces of cyclic and processor patches are also kept per patch so these
+// do not have to be searched for when transferring.
+template<class Type, class TrackingData>
+inline void mousse::FaceCellWave<Type, TrackingData>::setChangedFace
+(
+  const label faceI
+)
+{
+  if (changedFace_[faceI]) {
+    return;
+  }
+  changedFace_[faceI] = true;
+  changedFaces_[nChangedFaces_++] = faceI;
+  const label bFaceI = faceI - mesh_.nInternalFaces();
+  if (bFaceI >= 0) {
+    const label patchI = mesh_.boundaryMesh().patchID()[bFaceI];
+    if (coupledPatch_[patchI]) {
+      changedPatchFaces_[patchI].append
+      (
+        faceI - mesh_.boundaryMesh()[patchI].start()
+      );
+    }
+  }
+}
+
+
 // Update info for cellI, at position pt, with information from
 // neighbouring face/cell.
 // Updates:
@@ -145,10 +172,7 @@ bool mousse::FaceCellWave<Type, TrackingData>::updateFace
       td_
     );
   if (propagate) {
-    if (!changedFace_[faceI]) {
-      changedFace_[faceI] = true;
-      changedFaces_[nChangedFaces_++] = faceI;
-    }
+    setChangedFace(faceI);
   }
   if (!wasValid && faceInfo.valid(td_)) {
     --nUnvisitedFaces_;
@@ -183,10 +207,7 @@ bool mousse::FaceCellWave<Type, TrackingData>::updateFace
       td_
     );
   if (propagate) {
-    if (!changedFace_[faceI]) {
-      changedFace_[faceI] = true;
-      changedFaces_[nChangedFaces_++] = faceI;
-    }
+    setChangedFace(faceI);
   }
   if (!wasValid && faceInfo.valid(td_)) {
     --nUnvisitedFaces_;
@@ -272,9 +293,8 @@ void mousse::FaceCellWave<Type, TrackingData>::setFaceInfo
     if (!wasValid && allFaceInfo_[faceI].valid(td_)) {
       --nUnvisitedFaces_;
     }
-    // Mark faceI as changed, both on list and on face itself.
-    changedFace_[faceI] = true;
-    changedFaces_[nChangedFaces_++] = faceI;
+    // Mark faceI as changed
+    setChangedFace(faceI);
   }
 }
 
@@ -307,30 +327,23 @@ void mousse::FaceCellWave<Type, TrackingData>::mergeFaceInfo
 }
 
 
-// Construct compact patchFace change arrays for a (slice of a) single patch.
-// changedPatchFaces in local patch numbering.
-// Return length of arrays.
+// Collect the info of the changed faces of a cyclic or processor patch
+// into changedPatchFacesInfo_. Returns the changed faces in local patch
+// numbering.
 template<class Type, class TrackingData>
-mousse::label mousse::FaceCellWave<Type, TrackingData>::getChangedPatchFaces
+const mousse::labelList&
+mousse::FaceCellWave<Type, TrackingData>::getChangedPatchFaces
 (
-  const polyPatch& patch,
-  const label startFaceI,
-  const label nFaces,
-  labelList& changedPatchFaces,
-  List<Type>& changedPatchFacesInfo
-) const
+  const polyPatch& patch
+)
 {
-  label nChangedPatchFaces = 0;
-  for (label i = 0; i < nFaces; i++) {
-    label patchFaceI = i + startFaceI;
-    label meshFaceI = patch.start() + patchFaceI;
-    if (changedFace_[meshFaceI]) {
-      changedPatchFaces[nChangedPatchFaces] = patchFaceI;
-      changedPatchFacesInfo[nChangedPatchFaces] = allFaceInfo_[meshFaceI];
-      nChangedPatchFaces++;
-    }
+  const labelList& changedPatchFaces = changedPatchFaces_[patch.index()];
+  changedPatchFacesInfo_.setSize(changedPatchFaces.size());
+  FOR_ALL(changedPatchFaces, i) {
+    changedPatchFacesInfo_[i] =
+      allFaceInfo_[patch.start() + changedPatchFaces[i]];
   }
-  return nChangedPatchFaces;
+  return changedPatchFaces;
 }
 
 
@@ -417,32 +430,23 @@ void mousse::FaceCellWave<Type, TrackingData>::handleProcPatches()
   const globalMeshData& pData = mesh_.globalData();
   // Which patches are processor patches
   const labelList& procPatches = pData.processorPatches();
-  // Send all
-  PstreamBuffers pBufs{Pstream::nonBlocking};
+  // Send all. Only the changed faces, which are kept per patch, are
+  // sent, and the sizes are only exchanged with the neighbours.
+  pBufs_.clear();
   FOR_ALL(procPatches, i) {
     label patchI = procPatches[i];
     const processorPolyPatch& procPatch =
       refCast<const processorPolyPatch>(mesh_.boundaryMesh()[patchI]);
-    // Allocate buffers
-    label nSendFaces;
-    labelList sendFaces(procPatch.size());
-    List<Type> sendFacesInfo(procPatch.size());
     // Determine which faces changed on current patch
-    nSendFaces = getChangedPatchFaces
-    (
-      procPatch,
-      0,
-      procPatch.size(),
-      sendFaces,
-      sendFacesInfo
-    );
+    const labelList& sendFaces = getChangedPatchFaces(procPatch);
+    label nSendFaces = sendFaces.size();
     // Adapt wallInfo for leaving domain
     leaveDomain
     (
       procPatch,
       nSendFaces,
       sendFaces,
-      sendFacesInfo
+      changedPatchFacesInfo_
     );
     if (debug & 2) {
       Pout << " Processor patch " << patchI << ' ' << procPatch.name()
@@ -450,13 +454,13 @@ void mousse::FaceCellWave<Type, TrackingData>::handleProcPatches()
         << "  Sending:" << nSendFaces
         << endl;
     }
-    UOPstream toNeighbour{procPatch.neighbProcNo(), pBufs};
-    //writeFaces(nSendFaces, sendFaces, sendFacesInfo, toNeighbour);
+    UOPstream toNeighbour{procPatch.neighbProcNo(), pBufs_};
     toNeighbour
       << SubList<label>(sendFaces, nSendFaces)
-      << SubList<Type>(sendFacesInfo, nSendFaces);
+      << SubList<Type>(changedPatchFacesInfo_, nSendFaces);
   }
-  pBufs.finishedSends();
+  labelList nRecvBytes;
+  pBufs_.finishedNeighbourSends(pData[Pstream::myProcNo()], nRecvBytes);
   // Receive all
   FOR_ALL(procPatches, i) {
     label patchI = procPatches[i];
@@ -467,7 +471,7 @@ void mousse::FaceCellWave<Type, TrackingData>::handleProcPatches()
     List<Type> receiveFacesInfo;
 
     {
-      UIPstream fromNeighbour{procPatch.neighbProcNo(), pBufs};
+      UIPstream fromNeighbour{procPatch.neighbProcNo(), pBufs_};
       fromNeighbour >> receiveFaces >> receiveFacesInfo;
     }
 
@@ -515,19 +519,10 @@ void mousse::FaceCellWave<Type, TrackingData>::handleCyclicPatches()
     if (isA<cyclicPolyPatch>(patch)) {
       const cyclicPolyPatch& nbrPatch =
         refCast<const cyclicPolyPatch>(patch).neighbPatch();
-      // Allocate buffers
-      label nReceiveFaces;
-      labelList receiveFaces{patch.size()};
-      List<Type> receiveFacesInfo{patch.size()};
       // Determine which faces changed
-      nReceiveFaces = getChangedPatchFaces
-      (
-        nbrPatch,
-        0,
-        nbrPatch.size(),
-        receiveFaces,
-        receiveFacesInfo
-      );
+      const labelList& receiveFaces = getChangedPatchFaces(nbrPatch);
+      label nReceiveFaces = receiveFaces.size();
+      List<Type>& receiveFacesInfo = changedPatchFacesInfo_;
       // Adapt wallInfo for leaving domain
       leaveDomain
       (
@@ -674,6 +669,10 @@ mousse::FaceCellWave<Type, TrackingData>::FaceCellWave
   changedCell_{mesh_.nCells(), false},
   changedCells_{mesh_.nCells()},
   nChangedCells_{0},
+  coupledPatch_{mesh_.boundaryMesh().size(), false},
+  changedPatchFaces_{mesh_.boundaryMesh().size()},
+  changedPatchFacesInfo_{},
+  pBufs_{Pstream::nonBlocking},
   hasCyclicPatches_{hasPatch<cyclicPolyPatch>()},
   hasCyclicAMIPatches_
   {
@@ -699,6 +698,11 @@ mousse::FaceCellWave<Type, TrackingData>::FaceCellWave
     << "    mesh_.nCells():" << mesh_.nCells()
     << exit(FatalError);
   }
+  FOR_ALL(mesh_.boundaryMesh(), patchI) {
+    const polyPatch& patch = mesh_.boundaryMesh()[patchI];
+    coupledPatch_[patchI] =
+      isA<processorPolyPatch>(patch) || isA<cyclicPolyPatch>(patch);
+  }
 }
 
 
@@ -726,6 +730,10 @@ mousse::FaceCellWave<Type, TrackingData>::FaceCellWave
   changedCell_{mesh_.nCells(), false},
   changedCells_{mesh_.nCells()},
   nChangedCells_{0},
+  coupledPatch_{mesh_.boundaryMesh().size(), false},
+  changedPatchFaces_{mesh_.boundaryMesh().size()},
+  changedPatchFacesInfo_{},
+  pBufs_{Pstream::nonBlocking},
   hasCyclicPatches_{hasPatch<cyclicPolyPatch>()},
   hasCyclicAMIPatches_
   {
@@ -751,6 +759,11 @@ mousse::FaceCellWave<Type, TrackingData>::FaceCellWave
     << "    mesh_.nCells():" << mesh_.nCells()
     << exit(FatalError);
   }
+  FOR_ALL(mesh_.boundaryMesh(), patchI) {
+    const polyPatch& patch = mesh_.boundaryMesh()[patchI];
+    coupledPatch_[patchI] =
+      isA<processorPolyPatch>(patch) || isA<cyclicPolyPatch>(patch);
+  }
   // Copy initial changed faces data
   setFaceInfo(changedFaces, changedFacesInfo);
   // Iterate until nothing changes
@@ -842,6 +855,9 @@ mousse::label mousse::FaceCellWave<Type, TrackingData>::faceToCell()
   }
   // Handled all changed faces by now
   nChangedFaces_ = 0;
+  FOR_ALL(changedPatchFaces_, patchI) {
+    changedPatchFaces_[patchI].clear();
+  }
   if (debug & 2) {
     Pout << " Changed cells            : " << nChangedCells_ << endl;
   }
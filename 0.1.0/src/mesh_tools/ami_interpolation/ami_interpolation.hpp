@@ -95,6 +95,16 @@ private:
       //- Sum of weights of target faces per source face
       scalarField srcWeightsSum_;
 
+      //- Start of the target faces of every source face in the compact
+      //  addressing and weights. Size is number of source faces + 1.
+      labelList srcStart_;
+
+      //- Target faces of all source faces, in source face order
+      labelList srcCompactAddress_;
+
+      //- Weights of all source faces, in source face order
+      scalarList srcCompactWeights_;
+
     // Target patch
 
       //- Target face areas
@@ -109,6 +119,16 @@ private:
       //- Sum of weights of source faces per target face
       scalarField tgtWeightsSum_;
 
+      //- Start of the source faces of every target face in the compact
+      //  addressing and weights. Size is number of target faces + 1.
+      labelList tgtStart_;
+
+      //- Source faces of all target faces, in target face order
+      labelList tgtCompactAddress_;
+
+      //- Weights of all target faces, in target face order
+      scalarList tgtCompactWeights_;
+
     //- Face triangulation mode
     const faceAreaIntersect::triangulationMode triMode_;
 
@@ -190,6 +210,20 @@ private:
         const scalar lowWeightTol
       );
 
+      //- Copy the addressing and weights into contiguous storage for
+      //  the interpolation loops
+      static void compact
+      (
+        const labelListList& addr,
+        const scalarListList& wght,
+        labelList& start,
+        labelList& compactAddr,
+        scalarList& compactWght
+      );
+
+      //- Update the compact source and target addressing and weights
+      void calcCompactAddressing();
+
     // Constructor helpers
       static void agglomerate
       (
@@ -348,13 +382,23 @@ public:
 
     // Manipulation
 
-      //- Update addressing and weights
+      //- Update addressing and weights. The searches start from the
+      //  previous addressing if the patches are local and have not
+      //  changed size, e.g. after a rotation of one of them.
       void update
       (
         const SourcePatch& srcPatch,
         const TargetPatch& tgtPatch
       );
 
+      //- Update addressing and weights, with projection surface
+      void update
+      (
+        const SourcePatch& srcPatch,
+        const TargetPatch& tgtPatch,
+        const autoPtr<searchableSurface>& surf
+      );
+
     // Evaluation
 
       // Low-level
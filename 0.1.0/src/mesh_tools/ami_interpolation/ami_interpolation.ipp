@@ -211,6 +211,58 @@ void mousse::AMIInterpolation<SourcePatch, TargetPatch>::normaliseWeights
 }
 
 
+template<class SourcePatch, class TargetPatch>
+void mousse::AMIInterpolation<SourcePatch, TargetPatch>::compact
+(
+  const labelListList& addr,
+  const scalarListList& wght,
+  labelList& start,
+  labelList& compactAddr,
+  scalarList& compactWght
+)
+{
+  start.setSize(addr.size() + 1);
+  start[0] = 0;
+  FOR_ALL(addr, faceI) {
+    start[faceI + 1] = start[faceI] + addr[faceI].size();
+  }
+  compactAddr.setSize(start[addr.size()]);
+  compactWght.setSize(start[addr.size()]);
+  FOR_ALL(addr, faceI) {
+    const labelList& faces = addr[faceI];
+    const scalarList& weights = wght[faceI];
+    label compactI = start[faceI];
+    FOR_ALL(faces, i) {
+      compactAddr[compactI] = faces[i];
+      compactWght[compactI] = weights[i];
+      compactI++;
+    }
+  }
+}
+
+
+template<class SourcePatch, class TargetPatch>
+void mousse::AMIInterpolation<SourcePatch, TargetPatch>::calcCompactAddressing()
+{
+  compact
+  (
+    srcAddress_,
+    srcWeights_,
+    srcStart_,
+    srcCompactAddress_,
+    srcCompactWeights_
+  );
+  compact
+  (
+    tgtAddress_,
+    tgtWeights_,
+    tgtStart_,
+    tgtCompactAddress_,
+    tgtCompactWeights_
+  );
+}
+
+
 template<class SourcePatch, class TargetPatch>
 void mousse::AMIInterpolation<SourcePatch, TargetPatch>::agglomerate
 (
@@ -489,9 +541,15 @@ mousse::AMIInterpolation<SourcePatch, TargetPatch>::AMIInterpolation
   srcAddress_{},
   srcWeights_{},
   srcWeightsSum_{},
+  srcStart_{},
+  srcCompactAddress_{},
+  srcCompactWeights_{},
   tgtAddress_{},
   tgtWeights_{},
   tgtWeightsSum_{},
+  tgtStart_{},
+  tgtCompactAddress_{},
+  tgtCompactWeights_{},
   triMode_{triMode},
   srcMapPtr_{NULL},
   tgtMapPtr_{NULL}
@@ -520,9 +578,15 @@ mousse::AMIInterpolation<SourcePatch, TargetPatch>::AMIInterpolation
   srcAddress_{},
   srcWeights_{},
   srcWeightsSum_{},
+  srcStart_{},
+  srcCompactAddress_{},
+  srcCompactWeights_{},
   tgtAddress_{},
   tgtWeights_{},
   tgtWeightsSum_{},
+  tgtStart_{},
+  tgtCompactAddress_{},
+  tgtCompactWeights_{},
   triMode_{triMode},
   srcMapPtr_{NULL},
   tgtMapPtr_{NULL}
@@ -552,9 +616,15 @@ mousse::AMIInterpolation<SourcePatch, TargetPatch>::AMIInterpolation
   srcAddress_{},
   srcWeights_{},
   srcWeightsSum_{},
+  srcStart_{},
+  srcCompactAddress_{},
+  srcCompactWeights_{},
   tgtAddress_{},
   tgtWeights_{},
   tgtWeightsSum_{},
+  tgtStart_{},
+  tgtCompactAddress_{},
+  tgtCompactWeights_{},
   triMode_{triMode},
   srcMapPtr_{NULL},
   tgtMapPtr_{NULL}
@@ -582,9 +652,15 @@ mousse::AMIInterpolation<SourcePatch, TargetPatch>::AMIInterpolation
   srcAddress_{},
   srcWeights_{},
   srcWeightsSum_{},
+  srcStart_{},
+  srcCompactAddress_{},
+  srcCompactWeights_{},
   tgtAddress_{},
   tgtWeights_{},
   tgtWeightsSum_{},
+  tgtStart_{},
+  tgtCompactAddress_{},
+  tgtCompactWeights_{},
   triMode_{triMode},
   srcMapPtr_{NULL},
   tgtMapPtr_{NULL}
@@ -609,9 +685,15 @@ mousse::AMIInterpolation<SourcePatch, TargetPatch>::AMIInterpolation
   srcAddress_{},
   srcWeights_{},
   srcWeightsSum_{},
+  srcStart_{},
+  srcCompactAddress_{},
+  srcCompactWeights_{},
   tgtAddress_{},
   tgtWeights_{},
   tgtWeightsSum_{},
+  tgtStart_{},
+  tgtCompactAddress_{},
+  tgtCompactWeights_{},
   triMode_{fineAMI.triMode_},
   srcMapPtr_{NULL},
   tgtMapPtr_{NULL}
@@ -685,6 +767,7 @@ mousse::AMIInterpolation<SourcePatch, TargetPatch>::AMIInterpolation
     tgtWeightsSum_,
     srcMapPtr_
   );
+  calcCompactAddressing();
 }
 
 
@@ -695,6 +778,18 @@ mousse::AMIInterpolation<SourcePatch, TargetPatch>::~AMIInterpolation()
 
 
 // Member Functions 
+template<class SourcePatch, class TargetPatch>
+void mousse::AMIInterpolation<SourcePatch, TargetPatch>::update
+(
+  const SourcePatch& srcPatch,
+  const TargetPatch& tgtPatch,
+  const autoPtr<searchableSurface>& surfPtr
+)
+{
+  constructFromSurface(srcPatch, tgtPatch, surfPtr);
+}
+
+
 template<class SourcePatch, class TargetPatch>
 void mousse::AMIInterpolation<SourcePatch, TargetPatch>::update
 (
@@ -725,6 +820,11 @@ void mousse::AMIInterpolation<SourcePatch, TargetPatch>::update
   FOR_ALL(tgtMagSf_, faceI) {
     tgtMagSf_[faceI] = tgtPatch[faceI].mag(tgtPatch.points());
   }
+  // Addressing of a previous update between the same local patches,
+  // e.g. before a rotation, to seed the searches of this update with
+  const bool localSeeds =
+    singlePatchProc_ != -1 && srcAddress_.size() == srcPatch.size()
+    && tgtAddress_.size() == tgtPatch.size();
   // Calculate if patches present on multiple processors
   singlePatchProc_ = calcDistribution(srcPatch, tgtPatch);
   if (singlePatchProc_ == -1) {
@@ -874,6 +974,9 @@ void mousse::AMIInterpolation<SourcePatch, TargetPatch>::update
         requireMatch_
       )
     };
+    if (localSeeds) {
+      AMIPtr->setSeeds(srcAddress_);
+    }
     AMIPtr->calculate
     (
       srcAddress_,
@@ -904,6 +1007,7 @@ void mousse::AMIInterpolation<SourcePatch, TargetPatch>::update
       lowWeightCorrection_
     );
   }
+  calcCompactAddressing();
   if (debug) {
     Info << "AMIInterpolation : Constructed addressing and weights" << nl
       << "    triMode        :"
@@ -965,31 +1069,24 @@ void mousse::AMIInterpolation<SourcePatch, TargetPatch>::interpolateToTarget
     }
   }
   result.setSize(tgtAddress_.size());
+  List<Type> work;
   if (singlePatchProc_ == -1) {
-    const mapDistribute& map = srcMapPtr_();
-    List<Type> work{fld};
-    map.distribute(work);
-    FOR_ALL(result, faceI) {
-      if (tgtWeightsSum_[faceI] < lowWeightCorrection_) {
-        result[faceI] = defaultValues[faceI];
-      } else {
-        const labelList& faces = tgtAddress_[faceI];
-        const scalarList& weights = tgtWeights_[faceI];
-        FOR_ALL(faces, i) {
-          cop(result[faceI], faceI, work[faces[i]], weights[i]);
-        }
-      }
-    }
-  } else {
-    FOR_ALL(result, faceI) {
-      if (tgtWeightsSum_[faceI] < lowWeightCorrection_) {
-        result[faceI] = defaultValues[faceI];
-      } else {
-        const labelList& faces = tgtAddress_[faceI];
-        const scalarList& weights = tgtWeights_[faceI];
-        FOR_ALL(faces, i) {
-          cop(result[faceI], faceI, fld[faces[i]], weights[i]);
-        }
+    work = fld;
+    srcMapPtr_().distribute(work);
+  }
+  const UList<Type>& values = singlePatchProc_ == -1 ? work : fld;
+  FOR_ALL(result, faceI) {
+    if (tgtWeightsSum_[faceI] < lowWeightCorrection_) {
+      result[faceI] = defaultValues[faceI];
+    } else {
+      for (label i = tgtStart_[faceI]; i < tgtStart_[faceI + 1]; i++) {
+        cop
+        (
+          result[faceI],
+          faceI,
+          values[tgtCompactAddress_[i]],
+          tgtCompactWeights_[i]
+        );
       }
     }
   }
@@ -1045,31 +1142,24 @@ void mousse::AMIInterpolation<SourcePatch, TargetPatch>::interpolateToSource
     }
   }
   result.setSize(srcAddress_.size());
+  List<Type> work;
   if (singlePatchProc_ == -1) {
-    const mapDistribute& map = tgtMapPtr_();
-    List<Type> work{fld};
-    map.distribute(work);
-    FOR_ALL(result, faceI) {
-      if (srcWeightsSum_[faceI] < lowWeightCorrection_) {
-        result[faceI] = defaultValues[faceI];
-      } else {
-        const labelList& faces = srcAddress_[faceI];
-        const scalarList& weights = srcWeights_[faceI];
-        FOR_ALL(faces, i) {
-          cop(result[faceI], faceI, work[faces[i]], weights[i]);
-        }
-      }
-    }
-  } else {
-    FOR_ALL(result, faceI) {
-      if (srcWeightsSum_[faceI] < lowWeightCorrection_) {
-        result[faceI] = defaultValues[faceI];
-      } else {
-        const labelList& faces = srcAddress_[faceI];
-        const scalarList& weights = srcWeights_[faceI];
-        FOR_ALL(faces, i) {
-          cop(result[faceI], faceI, fld[faces[i]], weights[i]);
-        }
+    work = fld;
+    tgtMapPtr_().distribute(work);
+  }
+  const UList<Type>& values = singlePatchProc_ == -1 ? work : fld;
+  FOR_ALL(result, faceI) {
+    if (srcWeightsSum_[faceI] < lowWeightCorrection_) {
+      result[faceI] = defaultValues[faceI];
+    } else {
+      for (label i = srcStart_[faceI]; i < srcStart_[faceI + 1]; i++) {
+        cop
+        (
+          result[faceI],
+          faceI,
+          values[srcCompactAddress_[i]],
+          srcCompactWeights_[i]
+        );
       }
     }
   }
@@ -54,8 +54,12 @@ protected:
     //  (should be empty for correct functioning)
     labelList srcNonOverlap_;
 
-    //- Octree used to find face seeds
-    autoPtr<indexedOctree<treeType> > treePtr_;
+    //- Octree used to find face seeds, constructed on demand
+    mutable autoPtr<indexedOctree<treeType> > treePtr_;
+
+    //- Target face overlapping each source face in a previous
+    //  calculation, -1 if unknown
+    labelList srcSeeds_;
 
     //- Face triangulation mode
     const faceAreaIntersect::triangulationMode triMode_;
@@ -93,9 +97,16 @@ protected:
       //- Reset the octree for the target patch face search
       void resetTree();
 
+      //- Octree for the target patch face search
+      const indexedOctree<treeType>& tree() const;
+
       //- Find face on target patch that overlaps source face
       label findTargetFace(const label srcFaceI) const;
 
+      //- Find face on target patch to start the search for source face
+      //  from. Uses the seed of the face if that is known to overlap.
+      virtual label seedTargetFace(const label srcFaceI) const;
+
       //- Add faces neighbouring faceI to the ID list
       void appendNbrFaces
       (
@@ -183,6 +194,11 @@ public:
 
     // Manipulation
 
+      //- Seed the searches with the source addressing of a previous
+      //  calculation between the same patches, e.g. before the
+      //  patches were moved relative to each other
+      void setSeeds(const labelListList& srcAddress);
+
       //- Update addressing and weights
       virtual void calculate
       (
@@ -83,7 +83,7 @@ bool mousse::AMIMethod<SourcePatch, TargetPatch>::initialise
     tgtFaceI = 0;
     bool foundFace = false;
     FOR_ALL(srcPatch_, faceI) {
-      tgtFaceI = findTargetFace(faceI);
+      tgtFaceI = seedTargetFace(faceI);
       if (tgtFaceI >= 0) {
         srcFaceI = faceI;
         foundFace = true;
@@ -161,11 +161,22 @@ void mousse::AMIMethod<SourcePatch, TargetPatch>::writeIntersectionOBJ
 template<class SourcePatch, class TargetPatch>
 void mousse::AMIMethod<SourcePatch, TargetPatch>::resetTree()
 {
-  // Clear the old octree
+  // Clear the old octree. The new one is only constructed if a search
+  // cannot be seeded otherwise
   treePtr_.clear();
-  treeBoundBox bb{tgtPatch_.points()};
-  bb.inflate(0.01);
+}
+
+
+template<class SourcePatch, class TargetPatch>
+const mousse::indexedOctree
+<
+  typename mousse::AMIMethod<SourcePatch, TargetPatch>::treeType
+>&
+mousse::AMIMethod<SourcePatch, TargetPatch>::tree() const
+{
   if (!treePtr_.valid()) {
+    treeBoundBox bb{tgtPatch_.points()};
+    bb.inflate(0.01);
     treePtr_.reset
     (
       new indexedOctree<treeType>
@@ -183,6 +194,7 @@ void mousse::AMIMethod<SourcePatch, TargetPatch>::resetTree()
       }
     );
   }
+  return treePtr_();
 }
 
 
@@ -197,7 +209,7 @@ mousse::label mousse::AMIMethod<SourcePatch, TargetPatch>::findTargetFace
   const face& srcFace = srcPatch_[srcFaceI];
   const point srcPt = srcFace.centre(srcPts);
   const scalar srcFaceArea = srcMagSf_[srcFaceI];
-  pointIndexHit sample = treePtr_->findNearest(srcPt, 10.0*srcFaceArea);
+  pointIndexHit sample = tree().findNearest(srcPt, 10.0*srcFaceArea);
   if (sample.hit()) {
     targetFaceI = sample.index();
     if (debug) {
@@ -210,6 +222,16 @@ mousse::label mousse::AMIMethod<SourcePatch, TargetPatch>::findTargetFace
 }
 
 
+template<class SourcePatch, class TargetPatch>
+mousse::label mousse::AMIMethod<SourcePatch, TargetPatch>::seedTargetFace
+(
+  const label srcFaceI
+) const
+{
+  return findTargetFace(srcFaceI);
+}
+
+
 template<class SourcePatch, class TargetPatch>
 void mousse::AMIMethod<SourcePatch, TargetPatch>::appendNbrFaces
 (
@@ -272,6 +294,7 @@ mousse::AMIMethod<SourcePatch, TargetPatch>::AMIMethod
   srcMagSf_{srcMagSf},
   tgtMagSf_{tgtMagSf},
   srcNonOverlap_{},
+  srcSeeds_{},
   triMode_{triMode}
 {}
 
@@ -283,6 +306,26 @@ mousse::AMIMethod<SourcePatch, TargetPatch>::~AMIMethod()
 
 
 // Member Functions 
+template<class SourcePatch, class TargetPatch>
+void mousse::AMIMethod<SourcePatch, TargetPatch>::setSeeds
+(
+  const labelListList& srcAddress
+)
+{
+  srcSeeds_.clear();
+  if (srcAddress.size() != srcPatch_.size()) {
+    return;
+  }
+  srcSeeds_.setSize(srcAddress.size(), -1);
+  FOR_ALL(srcAddress, faceI) {
+    const labelList& addr = srcAddress[faceI];
+    if (addr.size() && addr[0] < tgtPatch_.size()) {
+      srcSeeds_[faceI] = addr[0];
+    }
+  }
+}
+
+
 template<class SourcePatch, class TargetPatch>
 bool mousse::AMIMethod<SourcePatch, TargetPatch>::conformal() const
 {
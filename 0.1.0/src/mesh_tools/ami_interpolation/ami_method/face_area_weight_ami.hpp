@@ -83,6 +83,11 @@ protected:
         const label tgtFaceI
       ) const;
 
+      //- Find face on target patch to start the search for source face
+      //  from. Tries the seed of the source face and its neighbours
+      //  before the octree search.
+      virtual label seedTargetFace(const label srcFaceI) const;
+
 public:
 
   //- Runtime type information
@@ -191,7 +191,7 @@ void mousse::faceAreaWeightAMI<SourcePatch, TargetPatch>::setNextFaces
           foundNextSeed = true;
         }
         srcFaceI = faceI;
-        tgtFaceI = this->findTargetFace(srcFaceI);
+        tgtFaceI = seedTargetFace(srcFaceI);
         if (tgtFaceI >= 0) {
           return;
         }
@@ -272,6 +272,34 @@ mousse::scalar mousse::faceAreaWeightAMI<SourcePatch, TargetPatch>::interArea
 }
 
 
+template<class SourcePatch, class TargetPatch>
+mousse::label
+mousse::faceAreaWeightAMI<SourcePatch, TargetPatch>::seedTargetFace
+(
+  const label srcFaceI
+) const
+{
+  const label seedI =
+    this->srcSeeds_.size() ? this->srcSeeds_[srcFaceI] : -1;
+  if (seedI != -1) {
+    // Faces moved by less than a face size still overlap the seed or one
+    // of its neighbours
+    const scalar minArea =
+      faceAreaIntersect::tolerance()*this->srcMagSf_[srcFaceI];
+    if (interArea(srcFaceI, seedI) > minArea) {
+      return seedI;
+    }
+    const labelList& nbrFaces = this->tgtPatch_.faceFaces()[seedI];
+    FOR_ALL(nbrFaces, i) {
+      if (interArea(srcFaceI, nbrFaces[i]) > minArea) {
+        return nbrFaces[i];
+      }
+    }
+  }
+  return this->findTargetFace(srcFaceI);
+}
+
+
 template<class SourcePatch, class TargetPatch>
 void mousse::faceAreaWeightAMI<SourcePatch, TargetPatch>::
 restartUncoveredSourceFace
@@ -325,7 +353,7 @@ restartUncoveredSourceFace
     DynamicList<label> visitedFaces{10};
     FOR_ALL_CONST_ITER(labelHashSet, lowWeightFaces, iter) {
       label srcFaceI = iter.key();
-      label tgtFaceI = this->findTargetFace(srcFaceI);
+      label tgtFaceI = seedTargetFace(srcFaceI);
       if (tgtFaceI != -1) {
         //bool faceProcessed =
         processSourceFace
@@ -277,18 +277,18 @@ mousse::scalar mousse::faceAreaIntersect::calc
       << abort(FatalError);
     }
   }
+  // triangle points of faceB, used for every triangle of faceA
+  List<triPoints> tpsB{trisB.size()};
+  FOR_ALL(trisB, tB) {
+    tpsB[tB] = getTriPoints(pointsB_, trisB[tB], !reverseB_);
+  }
   // intersect triangles
   scalar totalArea = 0.0;
   FOR_ALL(trisA, tA) {
     triPoints tpA = getTriPoints(pointsA_, trisA[tA], false);
-//        if (triArea(tpA) > ROOTVSMALL)
-    {
-      FOR_ALL(trisB, tB) {
-        triPoints tpB = getTriPoints(pointsB_, trisB[tB], !reverseB_);
-//                if (triArea(tpB) > ROOTVSMALL)
-        {
-          totalArea += triangleIntersect(tpA, tpB, n);
-        }
+    FOR_ALL(tpsB, tB) {
+      if (triOverlap(tpA, tpsB[tB], n)) {
+        totalArea += triangleIntersect(tpA, tpsB[tB], n);
       }
     }
   }
@@ -73,6 +73,15 @@ private:
     ) const;
     //- Return triangle area
     inline scalar triArea(const triPoints& t) const;
+    //- Return whether the projections of triangles src and tgt along n
+    //  overlap. Separating axis test on the edge normals, to skip the
+    //  cutting of triangles that do not intersect.
+    inline bool triOverlap
+    (
+      const triPoints& src,
+      const triPoints& tgt,
+      const vector& n
+    ) const;
     //- Slice triangle with plane and generate new cut sub-triangles
     void triSliceWithPlane
     (
@@ -189,6 +198,38 @@ inline mousse::scalar mousse::faceAreaIntersect::triArea(const triPoints& t) con
 }
 
 
+inline bool mousse::faceAreaIntersect::triOverlap
+(
+  const triPoints& src,
+  const triPoints& tgt,
+  const vector& n
+) const
+{
+  for (label triI = 0; triI < 2; triI++) {
+    const triPoints& t = triI == 0 ? src : tgt;
+    FOR_ALL(t, i) {
+      const vector axis = (t[t.fcIndex(i)] - t[i]) ^ n;
+      scalar minSrc = GREAT;
+      scalar maxSrc = -GREAT;
+      scalar minTgt = GREAT;
+      scalar maxTgt = -GREAT;
+      FOR_ALL(src, j) {
+        const scalar dSrc = src[j] & axis;
+        const scalar dTgt = tgt[j] & axis;
+        minSrc = min(minSrc, dSrc);
+        maxSrc = max(maxSrc, dSrc);
+        minTgt = min(minTgt, dTgt);
+        maxTgt = max(maxTgt, dTgt);
+      }
+      if (maxSrc < minTgt || maxTgt < minSrc) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+
 // Member Functions 
 mousse::scalar& mousse::faceAreaIntersect::tolerance()
 {
@@ -295,20 +295,26 @@ void mousse::cyclicAMIPolyPatch::resetAMI
     meshTools::writeOBJ(osO, this->localFaces(), localPoints());
   }
   // Construct/apply AMI interpolation to determine addressing and weights
-  AMIPtr_.reset
-  (
-    new AMIPatchToPatchInterpolation
-    {
-      *this,
-      nbrPatch0,
-      surfPtr(),
-      faceAreaIntersect::tmMesh,
-      AMIRequireMatch_,
-      AMIMethod,
-      AMILowWeightCorrection_,
-      AMIReverse_
-    }
-  );
+  if (AMIOldPtr_.valid()) {
+    // Same faces at new positions: start from the old addressing
+    AMIPtr_.reset(AMIOldPtr_.ptr());
+    AMIPtr_().update(*this, nbrPatch0, surfPtr());
+  } else {
+    AMIPtr_.reset
+    (
+      new AMIPatchToPatchInterpolation
+      {
+        *this,
+        nbrPatch0,
+        surfPtr(),
+        faceAreaIntersect::tmMesh,
+        AMIRequireMatch_,
+        AMIMethod,
+        AMILowWeightCorrection_,
+        AMIReverse_
+      }
+    );
+  }
   if (debug) {
     Pout<< "cyclicAMIPolyPatch : " << name()
       << " constructed AMI with " << nl
@@ -324,6 +330,7 @@ void mousse::cyclicAMIPolyPatch::initGeometry(PstreamBuffers& pBufs)
 {
   // Clear the invalid AMI
   AMIPtr_.clear();
+  AMIOldPtr_.clear();
   polyPatch::initGeometry(pBufs);
 }
 
@@ -349,8 +356,8 @@ void mousse::cyclicAMIPolyPatch::initMovePoints
   const pointField& p
 )
 {
-  // Clear the invalid AMI
-  AMIPtr_.clear();
+  // Keep the invalid AMI to update after the motion
+  AMIOldPtr_.reset(AMIPtr_.ptr());
   polyPatch::initMovePoints(pBufs, p);
   // See below. Clear out any local geometry
   primitivePatch::movePoints(p);
@@ -372,6 +379,7 @@ void mousse::cyclicAMIPolyPatch::initUpdateMesh(PstreamBuffers& pBufs)
 {
   // Clear the invalid AMI
   AMIPtr_.clear();
+  AMIOldPtr_.clear();
   polyPatch::initUpdateMesh(pBufs);
 }
 
@@ -385,6 +393,7 @@ void mousse::cyclicAMIPolyPatch::updateMesh(PstreamBuffers& pBufs)
 void mousse::cyclicAMIPolyPatch::clearGeom()
 {
   AMIPtr_.clear();
+  AMIOldPtr_.clear();
   polyPatch::clearGeom();
 }
 
@@ -410,6 +419,7 @@ mousse::cyclicAMIPolyPatch::cyclicAMIPolyPatch
   rotationAngle_{0.0},
   separationVector_{vector::zero},
   AMIPtr_{NULL},
+  AMIOldPtr_{NULL},
   AMIReverse_{false},
   AMIRequireMatch_{true},
   AMILowWeightCorrection_{-1.0},
@@ -440,6 +450,7 @@ mousse::cyclicAMIPolyPatch::cyclicAMIPolyPatch
   rotationAngle_{0.0},
   separationVector_{vector::zero},
   AMIPtr_{NULL},
+  AMIOldPtr_{NULL},
   AMIReverse_{dict.lookupOrDefault<bool>("flipNormals", false)},
   AMIRequireMatch_{true},
   AMILowWeightCorrection_{dict.lookupOrDefault("lowWeightCorrection", -1.0)},
@@ -541,6 +552,7 @@ mousse::cyclicAMIPolyPatch::cyclicAMIPolyPatch
   rotationAngle_{pp.rotationAngle_},
   separationVector_{pp.separationVector_},
   AMIPtr_{NULL},
+  AMIOldPtr_{NULL},
   AMIReverse_{pp.AMIReverse_},
   AMIRequireMatch_{pp.AMIRequireMatch_},
   AMILowWeightCorrection_{pp.AMILowWeightCorrection_},
@@ -572,6 +584,7 @@ mousse::cyclicAMIPolyPatch::cyclicAMIPolyPatch
   rotationAngle_{pp.rotationAngle_},
   separationVector_{pp.separationVector_},
   AMIPtr_{NULL},
+  AMIOldPtr_{NULL},
   AMIReverse_{pp.AMIReverse_},
   AMIRequireMatch_{pp.AMIRequireMatch_},
   AMILowWeightCorrection_{pp.AMILowWeightCorrection_},
@@ -616,6 +629,7 @@ mousse::cyclicAMIPolyPatch::cyclicAMIPolyPatch
   rotationAngle_{pp.rotationAngle_},
   separationVector_{pp.separationVector_},
   AMIPtr_{NULL},
+  AMIOldPtr_{NULL},
   AMIReverse_{pp.AMIReverse_},
   AMIRequireMatch_{pp.AMIRequireMatch_},
   AMILowWeightCorrection_{pp.AMILowWeightCorrection_},
@@ -56,6 +56,9 @@ protected:
         vector separationVector_;
     //- AMI interpolation class
     mutable autoPtr<AMIPatchToPatchInterpolation> AMIPtr_;
+    //- AMI interpolation before the last motion, updated in place of
+    //  constructing a new one so that its addressing seeds the search
+    mutable autoPtr<AMIPatchToPatchInterpolation> AMIOldPtr_;
     //- Flag to indicate that slave patch should be reversed for AMI
     const bool AMIReverse_;
     //- Flag to indicate that patches should match/overlap
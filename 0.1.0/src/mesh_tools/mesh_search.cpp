@@ -5,10 +5,13 @@
 #include "mesh_search.hpp"
 #include "poly_mesh.hpp"
 #include "indexed_octree.hpp"
+#include "indexed_bvh.hpp"
 #include "dynamic_list.hpp"
 #include "demand_driven_data.hpp"
 #include "tree_data_cell.hpp"
 #include "tree_data_face.hpp"
+#include "space_filling_curve.hpp"
+#include "register_switch.hpp"
 
 
 // Static Data Members
@@ -16,9 +19,23 @@ namespace mousse {
 
 DEFINE_TYPE_NAME_AND_DEBUG(meshSearch, 0);
 scalar meshSearch::tol_ = 1e-3;
+label meshSearch::nWalkSteps_ = 8;
+bool meshSearch::useCellBVH_
+(
+  debug::optimisationSwitch("meshSearchCellBVH", 0)
+);
+
+template class indexedBVH<treeDataCell>;
 
 }
 
+REGISTER_OPT_SWITCH
+(
+  "meshSearchCellBVH",
+  bool,
+  mousse::meshSearch::useCellBVH_
+);
+
 
 // Private Member Functions 
 bool mousse::meshSearch::findNearer
@@ -68,6 +85,35 @@ bool mousse::meshSearch::findNearer
 // tree based searching
 mousse::label mousse::meshSearch::findNearestCellTree(const point& location) const
 {
+  if (useCellBVH_) {
+    const indexedBVH<treeDataCell>& bvh = cellBVH();
+    if (bvh.nodes().empty()) {
+      return -1;
+    }
+    pointIndexHit info = bvh.findNearest
+    (
+      location,
+      magSqr(bvh.bb().max()-bvh.bb().min())
+    );
+    if (!info.hit()) {
+      info = bvh.findNearest(location, mousse::sqr(GREAT));
+    }
+    if (debug) {
+      const label treeCellI =
+        cellTree().findNearest(location, mousse::sqr(GREAT)).index();
+      const vectorField& centres = mesh_.cellCentres();
+      if (treeCellI != -1
+          && (!info.hit()
+              || (magSqr(centres[info.index()] - location)
+                  > magSqr(centres[treeCellI] - location) + VSMALL))) {
+        WARNING_IN("meshSearch::findNearestCellTree(const point&) const")
+          << "Nearest cell " << info.index() << " of " << location
+          << " from the bounding volume hierarchy is further away than"
+          << " cell " << treeCellI << " from the octree" << endl;
+      }
+    }
+    return info.index();
+  }
   const indexedOctree<treeDataCell>& tree = cellTree();
   pointIndexHit info = tree.findNearest
   (
@@ -244,13 +290,14 @@ mousse::label mousse::meshSearch::findCellLinear(const point& location) const
 mousse::label mousse::meshSearch::findCellWalk
 (
   const point& location,
-  const label seedCellI
+  const label seedCellI,
+  const label maxSteps
 ) const
 {
   if (seedCellI < 0) {
     FATAL_ERROR_IN
     (
-      "meshSearch::findCellWalk(const point&, const label)"
+      "meshSearch::findCellWalk(const point&, const label, const label)"
     )
     << "illegal seedCell:" << seedCellI << exit(FatalError);
   }
@@ -260,7 +307,7 @@ mousse::label mousse::meshSearch::findCellWalk
   // Walk in direction of face that decreases distance
   label curCellI = seedCellI;
   scalar nearestDistSqr = magSqr(mesh_.cellCentres()[curCellI] - location);
-  while(true) {
+  for (label stepI = 0; stepI < maxSteps; stepI++) {
     // Try neighbours of curCellI
     const cell& cFaces = mesh_.cells()[curCellI];
     label nearestCellI = -1;
@@ -490,6 +537,27 @@ const
 }
 
 
+const mousse::indexedBVH<mousse::treeDataCell>& mousse::meshSearch::cellBVH()
+const
+{
+  if (cellBVHPtr_.valid())
+    return cellBVHPtr_();
+  cellBVHPtr_.reset
+  (
+    new indexedBVH<treeDataCell>
+    {
+      treeDataCell
+      {
+        false,          // not cache bb
+        mesh_,
+        cellDecompMode_ // cell decomposition mode for inside tests
+      }
+    }
+  );
+  return cellBVHPtr_();
+}
+
+
 mousse::label mousse::meshSearch::findNearestCell
 (
   const point& location,
@@ -536,7 +604,23 @@ mousse::label mousse::meshSearch::findCell
 {
   // Find the nearest cell centre to this location
   if (seedCellI == -1) {
-    if (useTreeSearch) {
+    if (useTreeSearch && useCellBVH_) {
+      const label cellI = cellBVH().findInside(location);
+      if (debug) {
+        const label treeCellI = cellTree().findInside(location);
+        if ((cellI == -1) != (treeCellI == -1)) {
+          WARNING_IN
+          (
+            "meshSearch::findCell(const point&, const label, const bool)"
+            " const"
+          )
+          << "Cell " << cellI << " containing " << location
+          << " from the bounding volume hierarchy differs from cell "
+          << treeCellI << " from the octree" << endl;
+        }
+      }
+      return cellI;
+    } else if (useTreeSearch) {
       return cellTree().findInside(location);
     } else {
       return findCellLinear(location);
@@ -546,6 +630,77 @@ mousse::label mousse::meshSearch::findCell
 }
 
 
+mousse::labelList mousse::meshSearch::findCells
+(
+  const UList<point>& locations,
+  const bool useTreeSearch
+) const
+{
+  labelList cells{locations.size(), -1};
+  if (locations.empty() || mesh_.nCells() == 0) {
+    return cells;
+  }
+  const labelList order
+  {
+    spaceFillingCurve
+    {
+      spaceFillingCurve::HILBERT,
+      boundBox{locations, false}
+    }.order(locations)
+  };
+  label prevCellI = -1;
+  FOR_ALL(order, orderI) {
+    const label i = order[orderI];
+    label cellI = -1;
+    if (prevCellI != -1) {
+      cellI = findCellWalk(locations[i], prevCellI, nWalkSteps_);
+    }
+    if (cellI == -1) {
+      cellI = findCell(locations[i], -1, useTreeSearch);
+    }
+    cells[i] = cellI;
+    if (cellI != -1) {
+      prevCellI = cellI;
+    }
+  }
+  return cells;
+}
+
+
+mousse::labelList mousse::meshSearch::findUniqueCells
+(
+  const UList<point>& locations,
+  const bool useTreeSearch
+) const
+{
+  if (Pstream::parRun()
+      && (cellDecompMode_ == polyMesh::FACE_DIAG_TRIS
+          || cellDecompMode_ == polyMesh::CELL_TETS)) {
+    // Construct the tet decomposition, which uses parallel transfers,
+    // before a processor without cells or locations skips the search
+    (void)mesh_.tetBasePtIs();
+  }
+  labelList cells{findCells(locations, useTreeSearch)};
+  if (Pstream::parRun()) {
+    // Lowest processor containing every location
+    labelList procs{cells.size(), Pstream::nProcs()};
+    FOR_ALL(cells, i) {
+      if (cells[i] != -1) {
+        procs[i] = Pstream::myProcNo();
+      }
+    }
+    Pstream::listCombineGather(procs, minEqOp<label>());
+    Pstream::listCombineScatter(procs);
+    FOR_ALL(cells, i) {
+      if (procs[i] != Pstream::myProcNo()) {
+        cells[i] = -1;
+      }
+    }
+  }
+  return cells;
+}
+
+
 mousse::label mousse::meshSearch::findNearestBoundaryFace
 (
   const point& location,
@@ -653,6 +808,7 @@ void mousse::meshSearch::clearOut()
 {
   boundaryTreePtr_.clear();
   cellTreePtr_.clear();
+  cellBVHPtr_.clear();
   overallBbPtr_.clear();
 }
 
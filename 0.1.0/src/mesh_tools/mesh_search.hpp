@@ -9,6 +9,10 @@
 // Description
 //   Various (local, not parallel) searches on polyMesh;
 //   uses (demand driven) octree to search.
+//   The cell searches use a flat bounding volume hierarchy instead of the
+//   cell octree if the meshSearchCellBVH optimisation switch is set. With
+//   the meshSearch debug switch the results are checked against the
+//   octree.
 
 #include "point_index_hit.hpp"
 #include "point_field.hpp"
@@ -21,6 +25,7 @@ namespace mousse {
 class treeDataCell;
 class treeDataFace;
 template<class Type> class indexedOctree;
+template<class Type> class indexedBVH;
 class treeBoundBox;
 
 
@@ -36,6 +41,8 @@ class meshSearch
     //- Demand driven octrees
     mutable autoPtr<indexedOctree<treeDataFace> > boundaryTreePtr_;
     mutable autoPtr<indexedOctree<treeDataCell> > cellTreePtr_;
+    //- Demand driven bounding volume hierarchy of the cells
+    mutable autoPtr<indexedBVH<treeDataCell>> cellBVHPtr_;
   // Private Member Functions
     //- Updates nearestI, nearestDistSqr from any closer ones.
     static bool findNearer
@@ -65,8 +72,14 @@ class meshSearch
       //- Cell containing location. Linear search.
       label findCellLinear(const point&) const;
       //- Walk from seed. Does not 'go around' boundary, just returns
-      //  last cell before boundary.
-      label findCellWalk(const point&, const label) const;
+      //  last cell before boundary. Gives up (returns -1) after
+      //  maxSteps cells.
+      label findCellWalk
+      (
+        const point&,
+        const label,
+        const label maxSteps = labelMax
+      ) const;
     // Faces
       label findNearestFaceTree(const point&) const;
       label findNearestFaceLinear(const point&) const;
@@ -93,6 +106,11 @@ public:
   // Static data members
     //- Tolerance on linear dimensions
     static scalar tol_;
+    //- Maximum number of cells walked from the previous location in
+    //  findCells
+    static label nWalkSteps_;
+    //- Use the bounding volume hierarchy for the cell searches
+    static bool useCellBVH_;
   // Constructors
     //- Construct from components. Constructs bb slightly bigger than
     //  mesh points bb.
@@ -131,6 +149,9 @@ public:
       const indexedOctree<treeDataFace>& boundaryTree() const;
       //- Get (demand driven) reference to octree holding all cells
       const indexedOctree<treeDataCell>& cellTree() const;
+      //- Get (demand driven) reference to bounding volume hierarchy
+      //  holding all cells
+      const indexedBVH<treeDataCell>& cellBVH() const;
     // Queries
       //- Find nearest cell in terms of cell centre.
       //  Options:
@@ -160,6 +181,26 @@ public:
         const label seedCellI = -1,
         const bool useTreeSearch = true
       ) const;
+      //- Find cells containing locations.
+      //  Visits the locations along a Hilbert curve and walks a few cells
+      //  from the cell of the previous location before falling back to
+      //  tree/linear search, so coherent point sets (probe lines, arrays,
+      //  injector positions) are mostly found by walking.
+      //  Returns -1 for locations not in the (local) domain.
+      labelList findCells
+      (
+        const UList<point>& locations,
+        const bool useTreeSearch = true
+      ) const;
+      //- As findCells but in parallel every location is kept only by
+      //  the lowest numbered processor that contains it; the others
+      //  return -1. Uses a single collective for all locations, so has
+      //  to be called on all processors.
+      labelList findUniqueCells
+      (
+        const UList<point>& locations,
+        const bool useTreeSearch = true
+      ) const;
       //- Find nearest boundary face
       //  If seed provided walks but then does not pass local minima
       //  in distance. Also does not jump from one connected region to
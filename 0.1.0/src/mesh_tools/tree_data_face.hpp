@@ -119,6 +119,11 @@ public:
       //- Get representative point cloud for all shapes inside
       //  (one point per shape)
       pointField shapePoints() const;
+      //- Bounding box of the shape at index
+      inline treeBoundBox shapeBb(const label index) const
+      {
+        return cacheBb_ ? bbs_[index] : calcBb(faceLabels_[index]);
+      }
     // Search
       //- Get type (inside,outside,mixed,unknown) of point w.r.t. surface.
       //  Only makes sense for closed surfaces.
@@ -98,6 +98,13 @@ public:
       //- Get representative point cloud for all shapes inside
       //  (one point per shape)
       pointField shapePoints() const;
+      //- Bounding box of the shape at index
+      inline treeBoundBox shapeBb(const label index) const
+      {
+        const point& pt =
+          useSubset_ ? points_[pointLabels_[index]] : points_[index];
+        return treeBoundBox{pt, pt};
+      }
     // Search
       //- Get type (inside,outside,mixed,unknown) of point w.r.t. surface.
       //  Only makes sense for closed surfaces.
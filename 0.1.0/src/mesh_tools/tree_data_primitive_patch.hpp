@@ -181,6 +181,13 @@ public:
       //  (one point per shape)
       pointField shapePoints() const;
 
+      //- Bounding box of the shape at index
+      treeBoundBox shapeBb(const label index) const
+      {
+        return
+          cacheBb_ ? bbs_[index] : calcBb(patch_.points(), patch_[index]);
+      }
+
       //- Return access to the underlying patch
       const PatchType& patch() const
       {
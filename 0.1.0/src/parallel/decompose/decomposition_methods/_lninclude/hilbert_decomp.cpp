@@ -0,0 +1 @@
+../hilbert_decomp.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+../hilbert_decomp.hpp
\ No newline at end of file
@@ -0,0 +1,125 @@
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+
+#include "hilbert_decomp.hpp"
+#include "add_to_run_time_selection_table.hpp"
+#include "list_ops.hpp"
+#include "pstream_reduce_ops.hpp"
+
+
+namespace mousse {
+
+DEFINE_TYPE_NAME_AND_DEBUG(hilbertDecomp, 0);
+ADD_TO_RUN_TIME_SELECTION_TABLE
+(
+  decompositionMethod,
+  hilbertDecomp,
+  dictionary
+);
+
+}
+
+
+// Private Member Functions 
+mousse::List<uint64_t> mousse::hilbertDecomp::splitKeys
+(
+  const List<uint64_t>& sortedKeys,
+  const scalarField& cumulativeWeights
+) const
+{
+  const label nSplit = nProcessors_ - 1;
+  const scalar totalWeight =
+    returnReduce(cumulativeWeights.last(), sumOp<scalar>());
+  // Split key k is the smallest key with at least (k+1)/nProcessors_ of
+  // the total weight below it. Bisect all split keys simultaneously; the
+  // bounds are identical on all processors so only the weight sums need
+  // to be reduced.
+  List<uint64_t> lower{nSplit, uint64_t(0)};
+  List<uint64_t> upper{nSplit, uint64_t(1) << (3*spaceFillingCurve::nBits)};
+  scalarField weightBelow{nSplit};
+  List<uint64_t> mid{nSplit};
+  for (label iter = 0; iter <= 3*spaceFillingCurve::nBits; iter++) {
+    bool converged = true;
+    FOR_ALL(mid, k) {
+      mid[k] = lower[k] + (upper[k] - lower[k])/2;
+      // Number of local keys < mid
+      const label nBelow = findLower(sortedKeys, mid[k]) + 1;
+      weightBelow[k] = cumulativeWeights[nBelow];
+      if (lower[k] < upper[k]) {
+        converged = false;
+      }
+    }
+    if (converged) {
+      break;
+    }
+    Pstream::listCombineGather(weightBelow, plusEqOp<scalar>());
+    Pstream::listCombineScatter(weightBelow);
+    FOR_ALL(mid, k) {
+      if (lower[k] < upper[k]) {
+        if (weightBelow[k] >= (k + 1)*totalWeight/nProcessors_) {
+          upper[k] = mid[k];
+        } else {
+          lower[k] = mid[k] + 1;
+        }
+      }
+    }
+  }
+  return lower;
+}
+
+
+// Constructors 
+mousse::hilbertDecomp::hilbertDecomp(const dictionary& decompositionDict)
+:
+  decompositionMethod{decompositionDict},
+  curve_{spaceFillingCurve::HILBERT}
+{
+  const dictionary* coeffsPtr =
+    decompositionDict.subDictPtr(typeName + "Coeffs");
+  if (coeffsPtr && coeffsPtr->found("curve")) {
+    curve_ =
+      spaceFillingCurve::curveTypeNames.read(coeffsPtr->lookup("curve"));
+  }
+}
+
+
+// Member Functions 
+mousse::labelList mousse::hilbertDecomp::decompose
+(
+  const pointField& points
+)
+{
+  return decompose(points, scalarField{points.size(), 1.0});
+}
+
+
+mousse::labelList mousse::hilbertDecomp::decompose
+(
+  const pointField& points,
+  const scalarField& weights
+)
+{
+  // Global bounding box so that all processors share the same curve
+  const spaceFillingCurve curve{curve_, boundBox{points, true}};
+  const List<uint64_t> keys{curve.keys(points)};
+  labelList order;
+  sortedOrder(keys, order);
+  List<uint64_t> sortedKeys{keys.size()};
+  scalarField cumulativeWeights{keys.size() + 1};
+  cumulativeWeights[0] = 0;
+  FOR_ALL(order, i) {
+    sortedKeys[i] = keys[order[i]];
+    cumulativeWeights[i + 1] = cumulativeWeights[i] + weights[order[i]];
+  }
+  const List<uint64_t> split{splitKeys(sortedKeys, cumulativeWeights)};
+  // Walk the sorted keys and the split keys together
+  labelList finalDecomp{points.size()};
+  label procI = 0;
+  FOR_ALL(order, i) {
+    while (procI < split.size() && sortedKeys[i] >= split[procI]) {
+      procI++;
+    }
+    finalDecomp[order[i]] = procI;
+  }
+  return finalDecomp;
+}
@@ -0,0 +1,91 @@
+#ifndef PARALLEL_DECOMPOSE_DECOMPOSITION_METHODS_HILBERT_DECOMP_HPP_
+#define PARALLEL_DECOMPOSE_DECOMPOSITION_METHODS_HILBERT_DECOMP_HPP_
+
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+// Class
+//   mousse::hilbertDecomp
+// Description
+//   Space-filling-curve decomposition. Cell centres are ordered along a 3D
+//   Hilbert curve (or Morton curve) and the curve is cut into
+//   numberOfSubdomains pieces of equal (weighted) size.
+//   The method is fully distributed: every processor only sorts its own
+//   keys and the splitting keys are located by a bisection of the key
+//   space in which each step reduces one partial weight sum per domain.
+//   No points are gathered on the master and no points are moved.
+//   \verbatim
+//   method          hilbert;
+//   hilbertCoeffs               // optional
+//   {
+//       curve       hilbert;    // or morton
+//   }
+//   \endverbatim
+
+#include "decomposition_method.hpp"
+#include "space_filling_curve.hpp"
+
+
+namespace mousse {
+
+class hilbertDecomp
+:
+  public decompositionMethod
+{
+  // Private data
+    //- Curve to order the points along
+    spaceFillingCurve::curveType curve_;
+  // Private Member Functions
+    //- Return the nProcessors_-1 keys at which the curve is cut
+    List<uint64_t> splitKeys
+    (
+      const List<uint64_t>& sortedKeys,
+      const scalarField& cumulativeWeights
+    ) const;
+public:
+  //- Runtime type information
+  TYPE_NAME("hilbert");
+  // Constructors
+    //- Construct given the decomposition dictionary
+    hilbertDecomp(const dictionary& decompositionDict);
+    //- Disallow default bitwise copy construct and assignment
+    hilbertDecomp& operator=(const hilbertDecomp&) = delete;
+    hilbertDecomp(const hilbertDecomp&) = delete;
+  //- Destructor
+  virtual ~hilbertDecomp()
+  {}
+  // Member Functions
+    virtual bool parallelAware() const
+    {
+      // The curve is cut consistently across all processors.
+      return true;
+    }
+    virtual labelList decompose(const pointField&);
+    virtual labelList decompose(const pointField&, const scalarField&);
+    virtual labelList decompose(const polyMesh&, const pointField& points)
+    {
+      return decompose(points);
+    }
+    virtual labelList decompose
+    (
+      const polyMesh&,
+      const pointField& points,
+      const scalarField& pointWeights
+    )
+    {
+      return decompose(points, pointWeights);
+    }
+    //- Explicitly provided connectivity
+    virtual labelList decompose
+    (
+      const labelListList& /*globalCellCells*/,
+      const pointField& cc,
+      const scalarField& cWeights
+    )
+    {
+      return decompose(cc, cWeights);
+    }
+};
+
+}  // namespace mousse
+
+#endif
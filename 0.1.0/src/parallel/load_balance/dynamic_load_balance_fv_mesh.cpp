@@ -0,0 +1,275 @@
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+
+#include "dynamic_load_balance_fv_mesh.hpp"
+#include "add_to_run_time_selection_table.hpp"
+#include "decomposition_method.hpp"
+#include "fv_mesh_distribute.hpp"
+#include "cloud.hpp"
+#include "time.hpp"
+
+
+// Static Data Members
+namespace mousse {
+
+DEFINE_TYPE_NAME_AND_DEBUG(dynamicLoadBalanceFvMesh, 0);
+ADD_TO_RUN_TIME_SELECTION_TABLE
+(
+  dynamicFvMesh,
+  dynamicLoadBalanceFvMesh,
+  IOobject
+);
+
+}
+
+
+// Private Member Functions
+void mousse::dynamicLoadBalanceFvMesh::readDict()
+{
+  const dictionary balanceDict
+  {
+    IOdictionary
+    {
+      {
+        "dynamicMeshDict",
+        time().constant(),
+        *this,
+        IOobject::MUST_READ,
+        IOobject::NO_WRITE,
+        false
+      }
+    }.subDict(typeName + "Coeffs")
+  };
+  balanceInterval_ = readLabel(balanceDict.lookup("balanceInterval"));
+  if (balanceInterval_ < 1) {
+    FATAL_IO_ERROR_IN("dynamicLoadBalanceFvMesh::readDict()", balanceDict)
+      << "Illegal balanceInterval " << balanceInterval_ << nl
+      << "The balanceInterval setting in the dynamicMeshDict should"
+      << " be >= 1." << nl
+      << exit(FatalIOError);
+  }
+  maxImbalance_ = readScalar(balanceDict.lookup("maxImbalance"));
+  cellWeight_ = balanceDict.lookupOrDefault<scalar>("cellWeight", 1);
+  particleWeight_ = balanceDict.lookupOrDefault<scalar>("particleWeight", 0);
+  measureParticleWeight_ =
+    balanceDict.lookupOrDefault<Switch>("measureParticleWeight", false);
+  mergeTol_ = balanceDict.lookupOrDefault<scalar>("mergeTolerance", 1e-6);
+  if (balanceDict.found("loadFields")) {
+    const dictionary& loadDict = balanceDict.subDict("loadFields");
+    loadFieldNames_ = loadDict.toc();
+    loadFieldWeights_.setSize(loadFieldNames_.size());
+    FOR_ALL(loadFieldNames_, i) {
+      loadFieldWeights_[i] = readScalar(loadDict.lookup(loadFieldNames_[i]));
+    }
+  } else {
+    loadFieldNames_.clear();
+    loadFieldWeights_.clear();
+  }
+}
+
+
+mousse::wordList mousse::dynamicLoadBalanceFvMesh::fixedClouds() const
+{
+  DynamicList<word> names;
+  HashTable<const cloud*> clouds{lookupClass<cloud>()};
+  FOR_ALL_CONST_ITER(HashTable<const cloud*>, clouds, iter) {
+    if (!iter()->redistributable()) {
+      names.append(iter.key());
+    }
+  }
+  return wordList{names.xfer()};
+}
+
+
+mousse::labelList mousse::dynamicLoadBalanceFvMesh::cellParticles() const
+{
+  labelList nCellParticles{nCells(), 0};
+  HashTable<const cloud*> clouds{lookupClass<cloud>()};
+  FOR_ALL_CONST_ITER(HashTable<const cloud*>, clouds, iter) {
+    iter()->countCellParticles(nCellParticles);
+  }
+  return nCellParticles;
+}
+
+
+void mousse::dynamicLoadBalanceFvMesh::measureParticleWeight
+(
+  const scalar cpuTime,
+  const label nParticles
+)
+{
+  scalar trackingTime = 0;
+  HashTable<cloud*> clouds{lookupClass<cloud>()};
+  FOR_ALL_ITER(HashTable<cloud*>, clouds, iter) {
+    trackingTime += iter()->trackingTime();
+    iter()->resetTrackingTime();
+  }
+  const scalar particleTime = returnReduce(trackingTime, sumOp<scalar>());
+  const scalar cellTime =
+    returnReduce(max(cpuTime - trackingTime, scalar(0)), sumOp<scalar>());
+  const label nTotalParticles = returnReduce(nParticles, sumOp<label>());
+  if (nTotalParticles > 0 && cellTime > VSMALL) {
+    particleWeight_ =
+      cellWeight_*(particleTime/nTotalParticles)
+     /(cellTime/returnReduce(nCells(), sumOp<label>()));
+    Info << "Measured particle weight: " << particleWeight_ << endl;
+  }
+}
+
+
+mousse::tmp<mousse::scalarField>
+mousse::dynamicLoadBalanceFvMesh::cellLoad
+(
+  const labelList& nCellParticles
+) const
+{
+  tmp<scalarField> tload{new scalarField{nCells(), cellWeight_}};
+  scalarField& load = tload();
+  if (particleWeight_ > 0) {
+    FOR_ALL(load, cellI) {
+      load[cellI] += particleWeight_*nCellParticles[cellI];
+    }
+  }
+  FOR_ALL(loadFieldNames_, i) {
+    typedef DimensionedField<scalar, volMesh> loadFieldType;
+    // Fields may appear after the first time step, e.g. chemistry
+    if (foundObject<loadFieldType>(loadFieldNames_[i])) {
+      load +=
+        loadFieldWeights_[i]
+       *lookupObject<loadFieldType>(loadFieldNames_[i]).field();
+    }
+  }
+  return tload;
+}
+
+
+mousse::scalar mousse::dynamicLoadBalanceFvMesh::imbalance(const scalar local)
+{
+  const scalar maxLocal = returnReduce(local, maxOp<scalar>());
+  const scalar mean = returnReduce(local, sumOp<scalar>())/Pstream::nProcs();
+  return mean > VSMALL ? maxLocal/mean - 1 : 0;
+}
+
+
+void mousse::dynamicLoadBalanceFvMesh::balance(const scalarField& cellWeights)
+{
+  const labelList distribution
+  {
+    decomposerPtr_().decompose(*this, cellWeights)
+  };
+  // Keep the particles and the internal fields out of the intermediate
+  // topology changes
+  HashTable<cloud*> clouds{lookupClass<cloud>()};
+  FOR_ALL_ITER(HashTable<cloud*>, clouds, iter) {
+    iter()->prepareRedistribute();
+  }
+  heldInternalFields<scalar> scalarFields{*this};
+  heldInternalFields<vector> vectorFields{*this};
+  heldInternalFields<sphericalTensor> sphericalTensorFields{*this};
+  heldInternalFields<symmTensor> symmTensorFields{*this};
+  heldInternalFields<tensor> tensorFields{*this};
+  const scalar mergeDist = mergeTol_*bounds().mag();
+  fvMeshDistribute distributor{*this, mergeDist};
+  autoPtr<mapDistributePolyMesh> map = distributor.distribute(distribution);
+  scalarFields.distribute(map());
+  vectorFields.distribute(map());
+  sphericalTensorFields.distribute(map());
+  symmTensorFields.distribute(map());
+  tensorFields.distribute(map());
+  FOR_ALL_ITER(HashTable<cloud*>, clouds, iter) {
+    iter()->redistribute(map());
+  }
+  // Write the redistributed mesh with the next fields
+  setInstance(time().timeName());
+}
+
+
+// Constructors
+mousse::dynamicLoadBalanceFvMesh::dynamicLoadBalanceFvMesh(const IOobject& io)
+:
+  dynamicFvMesh{io},
+  balanceInterval_{1},
+  maxImbalance_{0},
+  cellWeight_{1},
+  particleWeight_{0},
+  measureParticleWeight_{false},
+  loadFieldNames_{},
+  loadFieldWeights_{},
+  mergeTol_{1e-6},
+  decompositionDict_
+  {
+    {
+      "decomposeParDict",
+      time().system(),
+      *this,
+      IOobject::MUST_READ_IF_MODIFIED,
+      IOobject::NO_WRITE
+    }
+  },
+  decomposerPtr_{decompositionMethod::New(decompositionDict_)},
+  cpuTime0_{time().elapsedCpuTime()}
+{
+  readDict();
+  if (Pstream::parRun() && !decomposerPtr_().parallelAware()) {
+    FATAL_ERROR_IN
+    (
+      "dynamicLoadBalanceFvMesh::dynamicLoadBalanceFvMesh(const IOobject&)"
+    )
+      << "Decomposition method " << decomposerPtr_().type()
+      << " does not synchronise the decomposition across processor"
+      << " patches." << nl
+      << "Select a parallel aware method for load balancing."
+      << exit(FatalError);
+  }
+}
+
+
+// Destructor
+mousse::dynamicLoadBalanceFvMesh::~dynamicLoadBalanceFvMesh()
+{}
+
+
+// Member Functions
+bool mousse::dynamicLoadBalanceFvMesh::update()
+{
+  topoChanging(false);
+  if (!Pstream::parRun()) {
+    return false;
+  }
+  if (time().timeIndex() == 0 || time().timeIndex() % balanceInterval_ != 0) {
+    return false;
+  }
+  const scalar cpuTime = time().elapsedCpuTime();
+  const scalar cpuInterval = cpuTime - cpuTime0_;
+  cpuTime0_ = cpuTime;
+  const labelList nCellParticles{cellParticles()};
+  if (measureParticleWeight_) {
+    measureParticleWeight(cpuInterval, sum(nCellParticles));
+  }
+  const scalarField load{cellLoad(nCellParticles)};
+  const scalar loadImbalance = imbalance(sum(load));
+  Info << "Load imbalance: estimated " << loadImbalance
+    << ", measured CPU time " << imbalance(cpuInterval) << endl;
+  if (loadImbalance <= maxImbalance_) {
+    return false;
+  }
+  const wordList fixed{fixedClouds()};
+  if (returnReduce(fixed.size(), sumOp<label>())) {
+    WARNING_IN("dynamicLoadBalanceFvMesh::update()")
+      << "Not redistributing the mesh: the clouds " << fixed
+      << " cannot be redistributed" << endl;
+    return false;
+  }
+  const label nCellsBefore = nCells();
+  balance(load);
+  Info << "Redistributed mesh: cells on processors "
+    << returnReduce(nCellsBefore, minOp<label>()) << " to "
+    << returnReduce(nCellsBefore, maxOp<label>()) << " before, "
+    << returnReduce(nCells(), minOp<label>()) << " to "
+    << returnReduce(nCells(), maxOp<label>()) << " after; "
+    << "estimated load imbalance "
+    << imbalance(sum(cellLoad(cellParticles()))) << nl
+    << endl;
+  topoChanging(true);
+  return true;
+}
@@ -0,0 +1,154 @@
+#ifndef PARALLEL_LOAD_BALANCE_DYNAMIC_LOAD_BALANCE_FV_MESH_HPP_
+#define PARALLEL_LOAD_BALANCE_DYNAMIC_LOAD_BALANCE_FV_MESH_HPP_
+
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+// Class
+//   mousse::dynamicLoadBalanceFvMesh
+// Description
+//   Static mesh which is redistributed across the processors at run time
+//   when the computational load becomes unbalanced.
+//   Every balanceInterval time steps the load of every cell is estimated as
+//       cellWeight
+//     + particleWeight*(number of Lagrangian particles in the cell)
+//     + sum of the weighted loadFields
+//   where loadFields are registered per-cell fields, e.g. chemistryLoad,
+//   the number of chemistry integration sub-steps of the last solve.
+//   With measureParticleWeight the particle weight is calibrated at every
+//   check from the CPU time spent tracking particles relative to the
+//   remaining CPU time per cell since the previous check.
+//   When the load of the most loaded processor exceeds the mean by more
+//   than maxImbalance the cells are repartitioned with the weighted
+//   decomposition method of system/decomposeParDict and the mesh, its
+//   volume, surface and internal fields and the Lagrangian clouds are
+//   migrated with fvMeshDistribute.
+//   \verbatim
+//   dynamicFvMeshLibs ("libmousse_load_balance.so");
+//   dynamicFvMesh   dynamicLoadBalanceFvMesh;
+//   dynamicLoadBalanceFvMeshCoeffs
+//   {
+//       balanceInterval 10;
+//       maxImbalance    0.2;
+//       cellWeight      1;
+//       particleWeight  5;
+//       measureParticleWeight true;
+//       loadFields
+//       {
+//           chemistryLoad   2;
+//       }
+//       mergeTolerance  1e-6;
+//   }
+//   \endverbatim
+//   The decomposition method has to be parallel aware, e.g. ptscotch or
+//   hilbert. The coefficients are read once at construction. The mesh is
+//   not redistributed while a cloud that cannot follow the
+//   redistribution, e.g. a moleculeCloud, is registered.
+
+#include "dynamic_fv_mesh.hpp"
+#include "dimensioned_field.hpp"
+#include "vol_mesh.hpp"
+#include "dynamic_list.hpp"
+#include "iodictionary.hpp"
+#include "switch.hpp"
+
+
+namespace mousse {
+
+// Forward declaration of classes
+class decompositionMethod;
+class mapDistributePolyMesh;
+
+
+class dynamicLoadBalanceFvMesh
+:
+  public dynamicFvMesh
+{
+  // Private classes
+    //- Registered internal fields of one type, held out of the registry
+    //  while the mesh is distributed so that the intermediate topology
+    //  changes do not map them
+    template<class Type>
+    class heldInternalFields
+    {
+      //- The held fields
+      DynamicList<DimensionedField<Type, volMesh>*> fields_;
+      //- Whether each field was owned by the registry
+      DynamicList<bool> owned_;
+    public:
+      //- Check out the internal fields of the mesh
+      explicit heldInternalFields(const fvMesh& mesh);
+      //- Distribute the held fields and check them back in
+      void distribute(const mapDistributePolyMesh& map);
+    };
+
+  // Private data
+    //- Number of time steps between load checks
+    label balanceInterval_;
+    //- Tolerated relative excess of the maximum over the mean load
+    scalar maxImbalance_;
+    //- Base load of every cell
+    scalar cellWeight_;
+    //- Load of every Lagrangian particle
+    scalar particleWeight_;
+    //- Calibrate the particle weight from the measured tracking time
+    Switch measureParticleWeight_;
+    //- Names of the registered per-cell load fields
+    wordList loadFieldNames_;
+    //- Weights of the load fields
+    scalarList loadFieldWeights_;
+    //- Merge tolerance relative to the mesh bounding box
+    scalar mergeTol_;
+    //- Decomposition dictionary
+    IOdictionary decompositionDict_;
+    //- Decomposition method
+    autoPtr<decompositionMethod> decomposerPtr_;
+    //- Processor CPU time at the last load check
+    scalar cpuTime0_;
+
+  // Private Member Functions
+    //- Read the coefficients
+    void readDict();
+    //- Names of the registered clouds that cannot be redistributed
+    wordList fixedClouds() const;
+    //- Return the number of Lagrangian particles in every cell
+    labelList cellParticles() const;
+    //- Calibrate the particle weight from the CPU time spent tracking
+    //  and the CPU time of the whole step interval
+    void measureParticleWeight(const scalar cpuTime, const label nParticles);
+    //- Return the estimated load of every cell
+    tmp<scalarField> cellLoad(const labelList& nCellParticles) const;
+    //- Return the relative excess of the maximum over the mean of a
+    //  processor quantity
+    static scalar imbalance(const scalar local);
+    //- Repartition with the given cell weights and migrate the mesh,
+    //  fields and clouds
+    void balance(const scalarField& cellWeights);
+
+public:
+  //- Runtime type information
+  TYPE_NAME("dynamicLoadBalanceFvMesh");
+
+  // Constructors
+    //- Construct from IOobject
+    explicit dynamicLoadBalanceFvMesh(const IOobject& io);
+    //- Disallow default bitwise copy construct
+    dynamicLoadBalanceFvMesh(const dynamicLoadBalanceFvMesh&) = delete;
+    //- Disallow default bitwise assignment
+    dynamicLoadBalanceFvMesh& operator=
+    (
+      const dynamicLoadBalanceFvMesh&
+    ) = delete;
+
+  //- Destructor
+  virtual ~dynamicLoadBalanceFvMesh();
+
+  // Member Functions
+    //- Check the load balance and redistribute the mesh if needed
+    virtual bool update();
+};
+
+}  // namespace mousse
+
+#include "dynamic_load_balance_fv_mesh.ipp"
+
+#endif
@@ -0,0 +1,53 @@
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+
+#include "vol_fields.hpp"
+#include "map_distribute_poly_mesh.hpp"
+
+
+// Constructors
+template<class Type>
+mousse::dynamicLoadBalanceFvMesh::heldInternalFields<Type>::heldInternalFields
+(
+  const fvMesh& mesh
+)
+:
+  fields_{},
+  owned_{}
+{
+  typedef DimensionedField<Type, volMesh> FieldType;
+  typedef GeometricField<Type, fvPatchField, volMesh> GeoFieldType;
+  HashTable<const FieldType*> fields{mesh.lookupClass<FieldType>()};
+  FOR_ALL_ITER(typename HashTable<const FieldType*>, fields, iter) {
+    FieldType& fld = const_cast<FieldType&>(*iter());
+    // Volume fields are distributed by fvMeshDistribute
+    if (isA<GeoFieldType>(fld) || fld.size() != mesh.nCells()) {
+      continue;
+    }
+    // Checking out a field owned by the registry would delete it
+    owned_.append(fld.ownedByRegistry());
+    fld.release();
+    fld.checkOut();
+    fields_.append(&fld);
+  }
+}
+
+
+// Member Functions
+template<class Type>
+void mousse::dynamicLoadBalanceFvMesh::heldInternalFields<Type>::distribute
+(
+  const mapDistributePolyMesh& map
+)
+{
+  FOR_ALL(fields_, i) {
+    DimensionedField<Type, volMesh>& fld = *fields_[i];
+    map.distributeCellData(fld);
+    fld.checkIn();
+    if (owned_[i]) {
+      fld.store();
+    }
+  }
+  fields_.clear();
+  owned_.clear();
+}
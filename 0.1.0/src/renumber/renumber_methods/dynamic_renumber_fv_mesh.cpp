@@ -0,0 +1,179 @@
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+
+#include "dynamic_renumber_fv_mesh.hpp"
+#include "add_to_run_time_selection_table.hpp"
+#include "renumber_method.hpp"
+#include "poly_mesh_renumber.hpp"
+#include "map_poly_mesh.hpp"
+#include "cloud.hpp"
+#include "topo_set.hpp"
+#include "time.hpp"
+
+
+// Static Data Members
+namespace mousse {
+
+DEFINE_TYPE_NAME_AND_DEBUG(dynamicRenumberFvMesh, 0);
+ADD_TO_RUN_TIME_SELECTION_TABLE
+(
+  dynamicFvMesh,
+  dynamicRenumberFvMesh,
+  IOobject
+);
+
+}
+
+
+// Private Member Functions 
+mousse::wordList mousse::dynamicRenumberFvMesh::unmappedObjects() const
+{
+  DynamicList<word> names;
+  names.append(HashTable<const cloud*>{lookupClass<cloud>()}.toc());
+  names.append(HashTable<const topoSet*>{lookupClass<topoSet>()}.toc());
+  return wordList{names.xfer()};
+}
+
+
+void mousse::dynamicRenumberFvMesh::renumber()
+{
+  autoPtr<renumberMethod> method = renumberMethod::New(renumberDict_);
+  const label bandBefore =
+    returnReduce
+    (
+      polyMeshRenumber::bandwidth(faceOwner(), faceNeighbour()),
+      maxOp<label>()
+    );
+  const labelList cellOrder{method().renumber(*this, cellCentres())};
+  const labelList faceOrder{polyMeshRenumber::faceOrder(*this, cellOrder)};
+  const fileName oldPointsInstance{pointsInstance()};
+  const fileName oldFacesInstance{facesInstance()};
+  autoPtr<mapPolyMesh> map =
+    polyMeshRenumber::reorder(*this, cellOrder, faceOrder);
+  updateMesh(map);
+  // The mesh on disk keeps its original numbering: revert the instance
+  // and write flags set by the topology change
+  objectRegistry& obr = *this;
+  FOR_ALL_ITER(objectRegistry, obr, iter) {
+    regIOobject& obj = *iter();
+    if (obj.local() == polyMesh::meshSubDir) {
+      obj.writeOpt() = IOobject::NO_WRITE;
+      obj.instance() =
+        obj.name() == "points" ? oldPointsInstance : oldFacesInstance;
+    }
+  }
+  cellMap_ = map().cellMap();
+  faceMap_ = SubList<label>{map().faceMap(), nInternalFaces()};
+  flipFaces_ = map().flipFaceFlux();
+  renumbered_ = true;
+  Info << "Renumbered mesh using " << method().type() << nl
+    << "    band before : " << bandBefore << nl
+    << "    band after  : "
+    << returnReduce
+      (
+        polyMeshRenumber::bandwidth(faceOwner(), faceNeighbour()),
+        maxOp<label>()
+      )
+    << nl << endl;
+}
+
+
+void mousse::dynamicRenumberFvMesh::reorderFields(const bool toOriginal)
+{
+  reorderVolFields<scalar>(toOriginal);
+  reorderVolFields<vector>(toOriginal);
+  reorderVolFields<sphericalTensor>(toOriginal);
+  reorderVolFields<symmTensor>(toOriginal);
+  reorderVolFields<tensor>(toOriginal);
+  reorderSurfaceFields<scalar>(toOriginal);
+  reorderSurfaceFields<vector>(toOriginal);
+  reorderSurfaceFields<sphericalTensor>(toOriginal);
+  reorderSurfaceFields<symmTensor>(toOriginal);
+  reorderSurfaceFields<tensor>(toOriginal);
+}
+
+
+// Constructors 
+mousse::dynamicRenumberFvMesh::dynamicRenumberFvMesh(const IOobject& io)
+:
+  dynamicFvMesh{io},
+  renumberDict_
+  {
+    IOdictionary
+    {
+      {
+        "dynamicMeshDict",
+        time().constant(),
+        *this,
+        IOobject::MUST_READ,
+        IOobject::NO_WRITE,
+        false
+      }
+    }.subDict(typeName + "Coeffs")
+  },
+  renumbered_{false},
+  disabled_{false},
+  cellMap_{identity(nCells())},
+  faceMap_{identity(nInternalFaces())},
+  flipFaces_{}
+{}
+
+
+// Destructor 
+mousse::dynamicRenumberFvMesh::~dynamicRenumberFvMesh()
+{}
+
+
+// Member Functions 
+bool mousse::dynamicRenumberFvMesh::update()
+{
+  if (renumbered_ || disabled_) {
+    topoChanging(false);
+    return false;
+  }
+  const wordList unmapped{unmappedObjects()};
+  if (returnReduce(unmapped.size(), sumOp<label>())) {
+    WARNING_IN("dynamicRenumberFvMesh::update()")
+      << "Not renumbering the mesh: the registered clouds or sets "
+      << unmapped << " would be written in the renumbered ordering"
+      << endl;
+    disabled_ = true;
+    topoChanging(false);
+    return false;
+  }
+  renumber();
+  topoChanging(true);
+  return true;
+}
+
+
+bool mousse::dynamicRenumberFvMesh::writeObject
+(
+  IOstream::streamFormat fmt,
+  IOstream::versionNumber ver,
+  IOstream::compressionType cmp
+) const
+{
+  if (!renumbered_) {
+    return dynamicFvMesh::writeObjects(fmt, ver, cmp);
+  }
+  const wordList unmapped{unmappedObjects()};
+  if (unmapped.size()) {
+    FATAL_ERROR_IN
+    (
+      "dynamicRenumberFvMesh::writeObject"
+      "(IOstream::streamFormat, IOstream::versionNumber"
+      ", IOstream::compressionType) const"
+    )
+    << "Clouds or sets " << unmapped
+    << " were registered after the mesh was renumbered and cannot be"
+    << " written in the original numbering" << nl
+    << "    Construct them before the first mesh update"
+    << exit(FatalError);
+  }
+  dynamicRenumberFvMesh& mesh = const_cast<dynamicRenumberFvMesh&>(*this);
+  mesh.reorderFields(true);
+  bool writeOk = dynamicFvMesh::writeObjects(fmt, ver, cmp);
+  mesh.reorderFields(false);
+  return writeOk;
+}
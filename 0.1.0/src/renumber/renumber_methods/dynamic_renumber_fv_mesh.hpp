@@ -0,0 +1,110 @@
+#ifndef RENUMBER_RENUMBER_METHODS_DYNAMIC_RENUMBER_FV_MESH_HPP_
+#define RENUMBER_RENUMBER_METHODS_DYNAMIC_RENUMBER_FV_MESH_HPP_
+
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+// Class
+//   mousse::dynamicRenumberFvMesh
+// Description
+//   Static mesh which is renumbered for cache locality when the run starts.
+//   On the first update() the cells are reordered with the selected
+//   renumberMethod and the internal faces are put into upper-triangular
+//   order; all registered fields are mapped onto the new numbering.
+//   Mesh files are never rewritten and volume and surface fields are mapped
+//   back to the original numbering when they are written, so the case on
+//   disk is unaffected and restarts simply renumber again.
+//   Lagrangian clouds and sets hold cell and face labels that are not mapped
+//   back on writing: the mesh is left in its original numbering if any are
+//   registered when update() is first called, and writing fails if any
+//   are registered after the mesh has been renumbered.
+//   \verbatim
+//   dynamicFvMeshLibs ("libmousse_renumber_methods.so");
+//   dynamicFvMesh   dynamicRenumberFvMesh;
+//   dynamicRenumberFvMeshCoeffs
+//   {
+//       method          spaceFillingCurve;
+//       spaceFillingCurveCoeffs
+//       {
+//           curve       hilbert;
+//       }
+//   }
+//   \endverbatim
+
+#include "dynamic_fv_mesh.hpp"
+#include "hash_set.hpp"
+
+
+namespace mousse {
+
+class dynamicRenumberFvMesh
+:
+  public dynamicFvMesh
+{
+  // Private data
+    //- Renumber dictionary
+    dictionary renumberDict_;
+    //- Has the mesh been renumbered
+    bool renumbered_;
+    //- Has renumbering been disabled by registered clouds or sets
+    bool disabled_;
+    //- Original cell for every cell
+    labelList cellMap_;
+    //- Original face for every internal face
+    labelList faceMap_;
+    //- Internal faces whose orientation was flipped
+    labelHashSet flipFaces_;
+
+  // Private Member Functions
+    //- Names of the registered objects holding cell or face labels
+    //  that are not mapped back on writing
+    wordList unmappedObjects() const;
+    //- Renumber the mesh and map the fields
+    void renumber();
+    //- Reorder the volume fields to or from the original numbering
+    template<class Type>
+    void reorderVolFields(const bool toOriginal);
+    //- Reorder the surface fields to or from the original numbering
+    template<class Type>
+    void reorderSurfaceFields(const bool toOriginal);
+    //- Reorder all fields to or from the original numbering
+    void reorderFields(const bool toOriginal);
+
+public:
+  //- Runtime type information
+  TYPE_NAME("dynamicRenumberFvMesh");
+
+  // Constructors
+    //- Construct from IOobject
+    explicit dynamicRenumberFvMesh(const IOobject& io);
+    //- Disallow default bitwise copy construct
+    dynamicRenumberFvMesh(const dynamicRenumberFvMesh&) = delete;
+    //- Disallow default bitwise assignment
+    dynamicRenumberFvMesh& operator=(const dynamicRenumberFvMesh&) = delete;
+
+  //- Destructor
+  virtual ~dynamicRenumberFvMesh();
+
+  // Member Functions
+    //- Original cell for every cell
+    const labelList& cellMap() const
+    {
+      return cellMap_;
+    }
+    //- Renumber the mesh on the first call
+    virtual bool update();
+
+  // Writing
+    //- Write the fields in the original numbering. Mesh is not written.
+    virtual bool writeObject
+    (
+      IOstream::streamFormat fmt,
+      IOstream::versionNumber ver,
+      IOstream::compressionType cmp
+    ) const;
+};
+
+}  // namespace mousse
+
+#include "dynamic_renumber_fv_mesh.ipp"
+
+#endif
@@ -0,0 +1,55 @@
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+
+#include "vol_fields.hpp"
+#include "surface_fields.hpp"
+
+
+// Private Member Functions 
+template<class Type>
+void mousse::dynamicRenumberFvMesh::reorderVolFields(const bool toOriginal)
+{
+  typedef GeometricField<Type, fvPatchField, volMesh> GeoField;
+  HashTable<GeoField*> flds{objectRegistry::lookupClass<GeoField>()};
+  FOR_ALL_ITER(typename HashTable<GeoField*>, flds, iter) {
+    Field<Type>& fld = iter()->internalField();
+    const Field<Type> oldFld{fld};
+    if (toOriginal) {
+      FOR_ALL(cellMap_, celli) {
+        fld[cellMap_[celli]] = oldFld[celli];
+      }
+    } else {
+      FOR_ALL(cellMap_, celli) {
+        fld[celli] = oldFld[cellMap_[celli]];
+      }
+    }
+  }
+}
+
+
+template<class Type>
+void mousse::dynamicRenumberFvMesh::reorderSurfaceFields
+(
+  const bool toOriginal
+)
+{
+  typedef GeometricField<Type, fvsPatchField, surfaceMesh> GeoField;
+  HashTable<GeoField*> flds{objectRegistry::lookupClass<GeoField>()};
+  FOR_ALL_ITER(typename HashTable<GeoField*>, flds, iter) {
+    Field<Type>& fld = iter()->internalField();
+    const Field<Type> oldFld{fld};
+    if (toOriginal) {
+      FOR_ALL(faceMap_, facei) {
+        fld[faceMap_[facei]] =
+          flipFaces_.found(facei) ? -oldFld[facei] : oldFld[facei];
+      }
+    } else {
+      FOR_ALL(faceMap_, facei) {
+        fld[facei] =
+          flipFaces_.found(facei)
+          ? -oldFld[faceMap_[facei]]
+          : oldFld[faceMap_[facei]];
+      }
+    }
+  }
+}
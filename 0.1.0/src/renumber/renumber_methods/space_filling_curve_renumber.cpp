@@ -0,0 +1,66 @@
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+
+#include "space_filling_curve_renumber.hpp"
+#include "add_to_run_time_selection_table.hpp"
+
+
+namespace mousse {
+
+DEFINE_TYPE_NAME_AND_DEBUG(spaceFillingCurveRenumber, 0);
+ADD_TO_RUN_TIME_SELECTION_TABLE
+(
+  renumberMethod,
+  spaceFillingCurveRenumber,
+  dictionary
+);
+
+}
+
+
+// Constructors 
+mousse::spaceFillingCurveRenumber::spaceFillingCurveRenumber
+(
+  const dictionary& renumberDict
+)
+:
+  renumberMethod{renumberDict},
+  curve_{spaceFillingCurve::HILBERT}
+{
+  const dictionary* coeffsPtr =
+    renumberDict.subDictPtr(typeName + "Coeffs");
+  if (coeffsPtr && coeffsPtr->found("curve")) {
+    curve_ =
+      spaceFillingCurve::curveTypeNames.read(coeffsPtr->lookup("curve"));
+  }
+}
+
+
+// Member Functions 
+mousse::labelList mousse::spaceFillingCurveRenumber::renumber
+(
+  const pointField& points
+) const
+{
+  return spaceFillingCurve{curve_, boundBox{points, false}}.order(points);
+}
+
+
+mousse::labelList mousse::spaceFillingCurveRenumber::renumber
+(
+  const polyMesh& /*mesh*/,
+  const pointField& points
+) const
+{
+  return renumber(points);
+}
+
+
+mousse::labelList mousse::spaceFillingCurveRenumber::renumber
+(
+  const labelListList& /*cellCells*/,
+  const pointField& points
+) const
+{
+  return renumber(points);
+}
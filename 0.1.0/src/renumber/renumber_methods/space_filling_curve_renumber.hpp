@@ -0,0 +1,75 @@
+#ifndef RENUMBER_RENUMBER_METHODS_SPACE_FILLING_CURVE_RENUMBER_HPP_
+#define RENUMBER_RENUMBER_METHODS_SPACE_FILLING_CURVE_RENUMBER_HPP_
+
+// mousse: CFD toolbox
+// Copyright (C) 2016 mousse project
+// Class
+//   mousse::spaceFillingCurveRenumber
+// Description
+//   Geometric renumbering: cells are ordered along a Hilbert or Morton
+//   space-filling curve through the cell centres. Does not need the
+//   mesh connectivity.
+//   \verbatim
+//   method          spaceFillingCurve;
+//   spaceFillingCurveCoeffs
+//   {
+//       curve       hilbert;    // or morton
+//   }
+//   \endverbatim
+//   The coefficients dictionary is optional; the default curve is hilbert.
+
+#include "renumber_method.hpp"
+#include "space_filling_curve.hpp"
+
+
+namespace mousse {
+
+class spaceFillingCurveRenumber
+:
+  public renumberMethod
+{
+  // Private data
+    //- Curve to order the cells along
+    spaceFillingCurve::curveType curve_;
+public:
+  //- Runtime type information
+  TYPE_NAME("spaceFillingCurve");
+  // Constructors
+    //- Construct given the renumber dictionary
+    spaceFillingCurveRenumber(const dictionary& renumberDict);
+    //- Disallow default bitwise copy construct and assignment
+    spaceFillingCurveRenumber& operator=
+    (
+      const spaceFillingCurveRenumber&
+    ) = delete;
+    spaceFillingCurveRenumber(const spaceFillingCurveRenumber&) = delete;
+  //- Destructor
+  virtual ~spaceFillingCurveRenumber()
+  {}
+  // Member Functions
+    //- Return the order in which cells need to be visited, i.e.
+    //  from ordered back to original cell label.
+    //  This is only defined for geometric renumberMethods.
+    virtual labelList renumber(const pointField&) const;
+    //- Return the order in which cells need to be visited, i.e.
+    //  from ordered back to original cell label.
+    //  Use the mesh connectivity (if needed)
+    virtual labelList renumber
+    (
+      const polyMesh& mesh,
+      const pointField& cc
+    ) const;
+    //- Return the order in which cells need to be visited, i.e.
+    //  from ordered back to original cell label.
+    //  The connectivity is equal to mesh.cellCells() except
+    //  - the connections are across coupled patches
+    virtual labelList renumber
+    (
+      const labelListList& cellCells,
+      const pointField& cc
+    ) const;
+};
+
+}  // namespace mousse
+
+#endif
@@ -9,6 +9,7 @@
 #include "iomanip.hpp"
 #include "map_poly_mesh.hpp"
 #include "pstream_reduce_ops.hpp"
+#include "mesh_search.hpp"
 
 
 // Static Data Members
@@ -25,14 +26,12 @@ void mousse::probes::findElements(const fvMesh& mesh)
   if (debug) {
     Info << "probes: resetting sample locations" << endl;
   }
-  elementList_.clear();
-  elementList_.setSize(size());
+  // Cells of all probes in one search, every probe on one processor only
+  elementList_ = meshSearch{mesh}.findUniqueCells(*this);
   faceList_.clear();
   faceList_.setSize(size());
   FOR_ALL(*this, probeI) {
-    const vector& location = operator[](probeI);
-    const label cellI = mesh.findCell(location);
-    elementList_[probeI] = cellI;
+    const label cellI = elementList_[probeI];
     if (cellI != -1) {
       const labelList& cellFaces = mesh.cells()[cellI];
       const vector& cellCentre = mesh.cellCentres()[cellI];
@@ -51,56 +50,23 @@ void mousse::probes::findElements(const fvMesh& mesh)
       faceList_[probeI] = -1;
     }
     if (debug && (elementList_[probeI] != -1 || faceList_[probeI] != -1)) {
-      Pout << "probes : found point " << location
+      Pout << "probes : found point " << operator[](probeI)
         << " in cell " << elementList_[probeI]
         << " and face " << faceList_[probeI] << endl;
     }
   }
   // Check if all probes have been found.
-  FOR_ALL(elementList_, probeI) {
-    const vector& location = operator[](probeI);
-    label cellI = elementList_[probeI];
-    label faceI = faceList_[probeI];
-    // Check at least one processor with cell.
-    reduce(cellI, maxOp<label>());
-    reduce(faceI, maxOp<label>());
-    if (cellI == -1) {
-      if (Pstream::master()) {
-        WARNING_IN("findElements::findElements(const fvMesh&)")
-          << "Did not find location " << location
-          << " in any cell. Skipping location." << endl;
-      }
-    } else if (faceI == -1) {
-      if (Pstream::master()) {
-        WARNING_IN("probes::findElements(const fvMesh&)")
-          << "Did not find location " << location
-          << " in any face. Skipping location." << endl;
-      }
-    } else {
-      // Make sure location not on two domains.
-      if (elementList_[probeI] != -1 && elementList_[probeI] != cellI) {
-        WARNING_IN("probes::findElements(const fvMesh&)")
-          << "Location " << location
-          << " seems to be on multiple domains:"
-          << " cell " << elementList_[probeI]
-          << " on my domain " << Pstream::myProcNo()
-          << " and cell " << cellI << " on some other domain."
-          << endl
-          << "This might happen if the probe location is on"
-          << " a processor patch. Change the location slightly"
-          << " to prevent this." << endl;
-      }
-      if (faceList_[probeI] != -1 && faceList_[probeI] != faceI) {
+  boolList found{size()};
+  FOR_ALL(found, probeI) {
+    found[probeI] = elementList_[probeI] != -1;
+  }
+  Pstream::listCombineGather(found, orEqOp<bool>());
+  if (Pstream::master()) {
+    FOR_ALL(found, probeI) {
+      if (!found[probeI]) {
         WARNING_IN("probes::findElements(const fvMesh&)")
-          << "Location " << location
-          << " seems to be on multiple domains:"
-          << " cell " << faceList_[probeI]
-          << " on my domain " << Pstream::myProcNo()
-          << " and face " << faceI << " on some other domain."
-          << endl
-          << "This might happen if the probe location is on"
-          << " a processor patch. Change the location slightly"
-          << " to prevent this." << endl;
+          << "Did not find location " << operator[](probeI)
+          << " in any cell. Skipping location." << endl;
       }
     }
   }
@@ -50,8 +50,9 @@ void mousse::arraySet::calcSamples
   FOR_ALL(sampleCoords, i) {
     sampleCoords[i] = transform(coordSys_.R().R(), sampleCoords[i]);
   }
+  const labelList sampleCells{queryMesh.findCells(sampleCoords)};
   FOR_ALL(sampleCoords, sampleI) {
-    label cellI = queryMesh.findCell(sampleCoords[sampleI]);
+    label cellI = sampleCells[sampleI];
     if (cellI != -1) {
       samplingPts.append(sampleCoords[sampleI]);
       samplingCells.append(cellI);
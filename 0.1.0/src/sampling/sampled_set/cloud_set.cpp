@@ -30,9 +30,9 @@ void mousse::cloudSet::calcSamples
   DynamicList<scalar>& samplingCurveDist
 ) const
 {
-  const meshSearch& queryMesh = searchEngine();
+  const labelList sampleCells{searchEngine().findCells(sampleCoords_)};
   FOR_ALL(sampleCoords_, sampleI) {
-    label cellI = queryMesh.findCell(sampleCoords_[sampleI]);
+    label cellI = sampleCells[sampleI];
     if (cellI == -1)
       continue;
     samplingPts.append(sampleCoords_[sampleI]);
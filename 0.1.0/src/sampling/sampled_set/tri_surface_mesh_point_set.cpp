@@ -30,8 +30,9 @@ void mousse::triSurfaceMeshPointSet::calcSamples
   DynamicList<scalar>& samplingCurveDist
 ) const
 {
+  const labelList sampleCells{searchEngine().findCells(sampleCoords_)};
   FOR_ALL(sampleCoords_, sampleI) {
-    label cellI = searchEngine().findCell(sampleCoords_[sampleI]);
+    label cellI = sampleCells[sampleI];
     if (cellI == -1)
       continue;
     samplingPts.append(sampleCoords_[sampleI]);
@@ -52,6 +52,18 @@ mousse::basicChemistryModel::basicChemistryModel
     },
     mesh,
     {"deltaTChem0", dimTime, deltaTChemIni_}
+  },
+  cellLoad_
+  {
+    {
+      IOobject::groupName("chemistryLoad", phaseName),
+      mesh.time().timeName(),
+      mesh,
+      IOobject::NO_READ,
+      IOobject::NO_WRITE
+    },
+    mesh,
+    {"zero", dimless, 0}
   }
 {}
 
@@ -37,6 +37,9 @@ protected:
     const scalar deltaTChemIni_;
     //- Latest estimation of integration step
     DimensionedField<scalar, volMesh> deltaTChem_;
+    //- Number of integration sub-steps of every cell in the last solve.
+    //  Measures the per-cell cost of the chemistry for load balancing.
+    DimensionedField<scalar, volMesh> cellLoad_;
   // Protected Member Functions
     //- Return non-const access to the latest estimation of integration
     //  step, e.g. for multi-chemistry model
@@ -66,6 +69,8 @@ public:
     inline Switch chemistry() const;
     //- Return the latest estimation of integration step
     inline const DimensionedField<scalar, volMesh>& deltaTChem() const;
+    //- Return the number of integration sub-steps of every cell
+    inline const DimensionedField<scalar, volMesh>& cellLoad() const;
     // Functions to be derived in derived classes
       // Fields
         //- Return const access to chemical source terms [kg/m3/s]
@@ -130,6 +135,13 @@ mousse::basicChemistryModel::deltaTChem()
   return deltaTChem_;
 }
 
+
+inline const mousse::DimensionedField<mousse::scalar, mousse::volMesh>&
+mousse::basicChemistryModel::cellLoad() const
+{
+  return cellLoad_;
+}
+
 #include "basic_chemistry_model.ipp"
 
 #endif
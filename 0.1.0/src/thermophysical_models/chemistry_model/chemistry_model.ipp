@@ -616,17 +616,21 @@ mousse::scalar mousse::chemistryModel<CompType, ThermoType>::solve
       // Initialise time progress
       scalar timeLeft = deltaT[celli];
       // Calculate the chemical source terms
+      label nSubSteps = 0;
       while (timeLeft > SMALL) {
         scalar dt = timeLeft;
         this->solve(c, Ti, pi, dt, this->deltaTChem_[celli]);
         timeLeft -= dt;
+        nSubSteps++;
       }
+      this->cellLoad_[celli] = nSubSteps;
       deltaTMin = min(this->deltaTChem_[celli], deltaTMin);
       for (label i=0; i<nSpecie_; i++) {
         RR_[i][celli] =
           (c[i] - c0[i])*specieThermo_[i].W()/deltaT[celli];
       }
     } else {
+      this->cellLoad_[celli] = 0;
       for (label i=0; i<nSpecie_; i++) {
         RR_[i][celli] = 0;
       }
@@ -4,6 +4,7 @@
 
 #include "tri_surface.hpp"
 #include "ifstream.hpp"
+#include "hash.hpp"
 
 
 namespace mousse {
@@ -33,4 +34,44 @@ bool triSurface::readSTL(const fileName& STLfileName)
   return readSTLBINARY(STLfileName);
 }
 
+
+label triSurface::mergeIdenticalPoints
+(
+  const UList<floatVector>& points,
+  labelList& pointMap
+)
+{
+  // Open addressing table, at most half full, of the first point with
+  // the coordinates
+  label tableSize = 1;
+  while (tableSize < 2*points.size()) {
+    tableSize *= 2;
+  }
+  const label mask = tableSize - 1;
+  labelList table{tableSize, -1};
+  const Hash<floatVector> hasher;
+  pointMap.setSize(points.size());
+  label nUniquePoints = 0;
+  FOR_ALL(points, pointI) {
+    const floatVector& pt = points[pointI];
+    // Adding zero turns -0 into 0, which compare equal, so both hash
+    // the same
+    const floatVector key{pt.x() + 0.0f, pt.y() + 0.0f, pt.z() + 0.0f};
+    label slot = hasher(key) & mask;
+    while (true) {
+      const label firstI = table[slot];
+      if (firstI == -1) {
+        table[slot] = pointI;
+        pointMap[pointI] = nUniquePoints++;
+        break;
+      } else if (points[firstI] == pt) {
+        pointMap[pointI] = pointMap[firstI];
+        break;
+      }
+      slot = (slot + 1) & mask;
+    }
+  }
+  return nUniquePoints;
+}
+
 }  // namespace mousse
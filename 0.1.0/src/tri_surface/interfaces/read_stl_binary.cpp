@@ -3,12 +3,11 @@
 // Copyright (C) 2016 mousse project
 
 #include "tri_surface.hpp"
-#include "stl_triangle.hpp"
 #include "ifstream.hpp"
 #include "os_specific.hpp"
 #include "gzstream.h"
 #include "float_vector.hpp"
-#include "merge_points.hpp"
+#include <cstring>
 
 
 // Member Functions 
@@ -59,25 +58,39 @@ bool mousse::triSurface::readSTLBINARY(const fileName& STLfileName)
   // Allocate storage for raw points
   List<floatVector> STLpoints{3*nTris};
   setSize(nTris);
+  // Read blocks of triangles, each the normal, the three vertices and the
+  // attribute, and copy the vertices and attributes out
+  const label triSize = 12*sizeof(float) + sizeof(unsigned short);
+  const label nBlockTris = 8192;
+  List<char> block{nBlockTris*triSize};
   label pointI = 0;
-  for (label i = 0; i < nTris; i++) {
-    // Read an STL triangle
-    STLtriangle stlTri{STLfile};
-    // Set the STLpoints to the vertices of the STL triangle
-    STLpoints[pointI++] = stlTri.a();
-    STLpoints[pointI++] = stlTri.b();
-    STLpoints[pointI++] = stlTri.c();
-    operator[](i).region() = stlTri.attrib();
+  for (label startI = 0; startI < nTris; startI += nBlockTris) {
+    const label nRead = min(nBlockTris, nTris - startI);
+    STLfile.read(block.begin(), nRead*triSize);
+    if (!STLfile) {
+      FATAL_ERROR_IN("triSurface::readSTLBINARY(const fileName&)")
+        << "Premature end of file " << STLfileName
+        << " reading triangle " << startI << " of " << nTris
+        << exit(FatalError);
+    }
+    const char* triPtr = block.begin();
+    for (label i = 0; i < nRead; i++) {
+      // Skip the normal and copy the vertex components
+      float xyz[9];
+      std::memcpy(xyz, triPtr + 3*sizeof(float), sizeof(xyz));
+      for (label vertI = 0; vertI < 3; vertI++) {
+        STLpoints[pointI++] =
+          floatVector{xyz[3*vertI], xyz[3*vertI + 1], xyz[3*vertI + 2]};
+      }
+      unsigned short attrib;
+      std::memcpy(&attrib, triPtr + 12*sizeof(float), sizeof(attrib));
+      operator[](startI + i).region() = attrib;
+      triPtr += triSize;
+    }
   }
-  // Stitch points
+  // Stitch identical points
   labelList pointMap;
-  label nUniquePoints = mergePoints
-  (
-    STLpoints,
-    10*SMALL,               // merge distance
-    false,                  // verbose
-    pointMap                // old to new
-  );
+  label nUniquePoints = mergeIdenticalPoints(STLpoints, pointMap);
   pointField& sp = storedPoints();
   sp.setSize(nUniquePoints);
   FOR_ALL(STLpoints, pointI) {
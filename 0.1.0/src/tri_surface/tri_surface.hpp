@@ -11,6 +11,7 @@
 
 #include "_primitive_patch.hpp"
 #include "point_field.hpp"
+#include "float_vector.hpp"
 #include "labelled_tri.hpp"
 #include "bool_list.hpp"
 #include "geometric_surface_patch_list.hpp"
@@ -75,6 +76,15 @@ class triSurface
     bool readSTL(const fileName&);
     bool readSTLASCII(const fileName&);
     bool readSTLBINARY(const fileName&);
+    //- Merge the identical STL points through a hash table, which is
+    //  linear in the number of points. Returns the number of unique
+    //  points and sets pointMap to their index, in order of first
+    //  occurrence.
+    static label mergeIdenticalPoints
+    (
+      const UList<floatVector>& points,
+      labelList& pointMap
+    );
     bool readGTS(const fileName&);
     bool readOBJ(const fileName&);
     bool readOFF(const fileName&);